@@ -12,29 +12,12 @@
 #include <boost/version.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
-#include <boost/program_options/options_description.hpp>
 #include <boost/program_options/parsers.hpp>
 #include <boost/program_options/variables_map.hpp>
 
 int main(const int argc, const char *argv[]) {
-    boost::program_options::options_description _options("Options");
-    auto _push_option = _options.add_options();
-
-    _push_option("address", boost::program_options::value<std::string>()->default_value("0.0.0.0"));
-    _push_option("threads", boost::program_options::value<unsigned short>()->default_value(4));
-    _push_option("is_node", boost::program_options::value<bool>()->default_value(false));
-    _push_option("sessions_port", boost::program_options::value<unsigned short>()->default_value(11000));
-    _push_option("clients_port", boost::program_options::value<unsigned short>()->default_value(12000));
-    _push_option("remote_address", boost::program_options::value<std::string>()->default_value("localhost"));
-    _push_option("remote_sessions_port", boost::program_options::value<unsigned short>()->default_value(9000));
-    _push_option("remote_clients_port", boost::program_options::value<unsigned short>()->default_value(10000));
-    _push_option("ssl_client_listener_password", boost::program_options::value<std::string>()->default_value("36e422f3"));
-    _push_option("ssl_session_listener_password", boost::program_options::value<std::string>()->default_value("610191e8"));
-    _push_option("ssl_session_password", boost::program_options::value<std::string>()->default_value("5ec35a12"));
-    _push_option("ssl_client_password", boost::program_options::value<std::string>()->default_value("d96ab300"));
-
     boost::program_options::variables_map _vm;
-    store(parse_command_line(argc, argv, _options), _vm);
+    store(parse_command_line(argc, argv, engine::server::get_options()), _vm);
 
     const auto _server = std::make_shared<engine::server>();
 
@@ -43,15 +26,62 @@ int main(const int argc, const char *argv[]) {
     LOG_INFO("state version: {}.{}.{}", engine::version::get_major(), engine::version::get_minor(),
              engine::version::get_patch());
     LOG_INFO("boost version: {}", BOOST_VERSION);
+#if defined(BOOST_ASIO_HAS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL)
+    LOG_INFO("io backend: io_uring");
+#else
+    LOG_INFO("io backend: epoll");
+#endif
     LOG_INFO("configuration:");
     LOG_INFO("- threads: {}", _vm["threads"].as<unsigned short>());
+    LOG_INFO("- handshake_threads: {}", _vm["handshake_threads"].as<unsigned short>());
+    LOG_INFO("- session_lanes: {}", _vm["session_lanes"].as<unsigned short>());
+    LOG_INFO("- topology: {}", _vm["topology"].as<std::string>());
+    LOG_INFO("- relay_max_hops: {}", _vm["relay_max_hops"].as<unsigned short>());
+    LOG_INFO("- session_batch_messages: {}", _vm["session_batch_messages"].as<std::size_t>());
+    LOG_INFO("- session_batch_bytes: {}", _vm["session_batch_bytes"].as<std::size_t>());
+    LOG_INFO("- session_batch_delay: {}", _vm["session_batch_delay"].as<std::size_t>());
+    LOG_INFO("- peer_retention: {}", _vm["peer_retention"].as<unsigned short>());
+    LOG_INFO("- session_heartbeat_interval: {}", _vm["session_heartbeat_interval"].as<std::size_t>());
+    LOG_INFO("- session_heartbeat_misses: {}", _vm["session_heartbeat_misses"].as<unsigned short>());
+    LOG_INFO("- load_report_interval: {}", _vm["load_report_interval"].as<std::size_t>());
+    LOG_INFO("- load_threshold: {}", _vm["load_threshold"].as<std::size_t>());
+    LOG_INFO("- drain_deadline: {}", _vm["drain_deadline"].as<std::size_t>());
+    LOG_INFO("- dedup_ttl: {}", _vm["dedup_ttl"].as<std::size_t>());
+    LOG_INFO("- dedup_capacity: {}", _vm["dedup_capacity"].as<std::size_t>());
+    LOG_INFO("- history_messages: {}", _vm["history_messages"].as<std::size_t>());
+    LOG_INFO("- history_bytes: {}", _vm["history_bytes"].as<std::size_t>());
+    LOG_INFO("- history_age: {}", _vm["history_age"].as<std::size_t>());
+    LOG_INFO("- last_value_channels: {}", _vm["last_value_channels"].as<std::size_t>());
+    LOG_INFO("- client_rate_limit: {}", _vm["client_rate_limit"].as<std::size_t>());
+    LOG_INFO("- fanout_rate_limit: {}", _vm["fanout_rate_limit"].as<std::size_t>());
+    LOG_INFO("- channel_rate_limit: {}", _vm["channel_rate_limit"].as<std::size_t>());
+    LOG_INFO("- rate_limit_burst: {}", _vm["rate_limit_burst"].as<std::size_t>());
+    LOG_INFO("- queue_control_weight: {}", _vm["queue_control_weight"].as<std::size_t>());
+    LOG_INFO("- conflated_channels: {}", _vm["conflated_channels"].as<std::string>());
+    LOG_INFO("- batch_max_requests: {}", _vm["batch_max_requests"].as<std::size_t>());
+    LOG_INFO("- worker_threads: {}", _vm["worker_threads"].as<unsigned short>());
+    LOG_INFO("- worker_queue_capacity: {}", _vm["worker_queue_capacity"].as<std::size_t>());
+    LOG_INFO("- publish_log_path: {}", _vm["publish_log_path"].as<std::string>());
+    LOG_INFO("- publish_log_segment_bytes: {}", _vm["publish_log_segment_bytes"].as<std::size_t>());
+    LOG_INFO("- publish_log_segments: {}", _vm["publish_log_segments"].as<std::size_t>());
+    LOG_INFO("- publish_log_fsync: {}", _vm["publish_log_fsync"].as<std::string>());
+    LOG_INFO("- publish_log_fsync_interval: {}", _vm["publish_log_fsync_interval"].as<std::size_t>());
+    LOG_INFO("- publish_log_replay_bytes: {}", _vm["publish_log_replay_bytes"].as<std::size_t>());
+    LOG_INFO("- snapshot_path: {}", _vm["snapshot_path"].as<std::string>());
+    LOG_INFO("- snapshot_interval: {}", _vm["snapshot_interval"].as<std::size_t>());
+    LOG_INFO("- reliable_messages: {}", _vm["reliable_messages"].as<std::size_t>());
+    LOG_INFO("- reliable_bytes: {}", _vm["reliable_bytes"].as<std::size_t>());
+    LOG_INFO("- reliable_retention: {}", _vm["reliable_retention"].as<unsigned short>());
+    LOG_INFO("- reliable_orphans: {}", _vm["reliable_orphans"].as<std::size_t>());
     LOG_INFO("- address: {}", _vm["address"].as<std::string>());
     LOG_INFO("- sessions_port: {}", _vm["sessions_port"].as<unsigned short>());
     LOG_INFO("- clients_port: {}", _vm["clients_port"].as<unsigned short>());
+    LOG_INFO("- clients_socket_path: {}", _vm["clients_socket_path"].as<std::string>());
     LOG_INFO("- is_node: {}", _vm["is_node"].as<bool>());
     LOG_INFO("- remote_address: {}", _vm["remote_address"].as<std::string>());
     LOG_INFO("- remote_sessions_port: {}", _vm["remote_sessions_port"].as<unsigned short>());
     LOG_INFO("- remote_clients_port: {}", _vm["remote_clients_port"].as<unsigned short>());
+    LOG_INFO("- ssl_ktls: {}", _vm["ssl_ktls"].as<bool>());
 
     _server->start();
 
@@ -8,6 +8,7 @@ BUILD_TYPE=${1:-debug}
 LINK_TYPE=${2:-static}
 BUILD_THREADS=${3:-1}
 BUILD_TESTS=${4:-tests_on}
+IO_BACKEND=${5:-epoll}
 
 mkdir -p build
 cd build
@@ -30,6 +31,12 @@ else
 ENABLED_TESTS="OFF"
 fi
 
-cmake .. -DCMAKE_BUILD_TYPE=$BUILD_TYPE -DENABLE_TESTS=$ENABLED_TESTS -DENABLE_CI=ON -DENABLE_DEBUG=$ENABLE_DEBUG -DENABLE_STATIC_LINKING=$ENABLE_STATIC
+if [[ "$IO_BACKEND" == "io_uring" ]]; then
+ENABLE_IO_URING="ON"
+else
+ENABLE_IO_URING="OFF"
+fi
+
+cmake .. -DCMAKE_BUILD_TYPE=$BUILD_TYPE -DENABLE_TESTS=$ENABLED_TESTS -DENABLE_CI=ON -DENABLE_DEBUG=$ENABLE_DEBUG -DENABLE_STATIC_LINKING=$ENABLE_STATIC -DENABLE_IO_URING=$ENABLE_IO_URING
 
 make -j$BUILD_THREADS
\ No newline at end of file
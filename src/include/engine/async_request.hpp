@@ -0,0 +1,44 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_ASYNC_REQUEST_HPP
+#define ENGINE_ASYNC_REQUEST_HPP
+
+#include <engine/request.hpp>
+
+namespace engine {
+    /**
+     * Async Request
+     *
+     * Owning copy of a request for handlers that suspend, it lives in the coroutine frame while the connection
+     * keeps reading.
+     */
+    struct async_request {
+        boost::uuids::uuid transaction_id_;
+        std::shared_ptr<engine::response> response_;
+        boost::uuids::uuid entity_id_;
+        kernel_context context_;
+        std::shared_ptr<engine::state> state_;
+        boost::json::object data_;
+        long timestamp_;
+
+        /**
+         * Make
+         *
+         * @param request
+         * @return async_request
+         */
+        static async_request make(const request &request);
+
+        /**
+         * To Request
+         *
+         * @return request Referencing this async request, valid while it lives
+         */
+        request to_request();
+    };
+} // namespace engine
+
+#endif  // ENGINE_ASYNC_REQUEST_HPP
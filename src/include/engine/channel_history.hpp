@@ -0,0 +1,209 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_CHANNEL_HISTORY_HPP
+#define ENGINE_CHANNEL_HISTORY_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine {
+    /**
+     * Channel History
+     *
+     * Bounded history of the serialized envelopes published on a channel. Envelopes are copied into a single
+     * byte ring reserved up front and indexed by a fixed ring of entries, so appending never allocates. The
+     * oldest envelopes are evicted when the count, the bytes or the age limit is reached.
+     */
+    class channel_history {
+    public:
+        /**
+         * Entry
+         */
+        struct entry {
+            /**
+             * Sequence
+             */
+            std::uint64_t sequence_ = 0;
+
+            /**
+             * Timestamp
+             */
+            std::int64_t timestamp_ = 0;
+
+            /**
+             * Offset
+             */
+            std::size_t offset_ = 0;
+
+            /**
+             * Size
+             */
+            std::size_t size_ = 0;
+        };
+
+        /**
+         * Constructor
+         *
+         * @param messages
+         * @param bytes
+         * @param age Maximum age in system clock ticks (0: unlimited)
+         */
+        channel_history(std::size_t messages, std::size_t bytes, std::int64_t age);
+
+        /**
+         * Get Next Sequence
+         *
+         * @return uint64_t
+         */
+        std::uint64_t get_next_sequence() const;
+
+        /**
+         * Resume
+         *
+         * Continues the numbering of a persisted log, ignored once envelopes were appended.
+         *
+         * @param next_sequence
+         */
+        void resume(std::uint64_t next_sequence);
+
+        /**
+         * Append
+         *
+         * Consumes the next sequence even when the envelope doesn't fit, so clients can detect the gap.
+         *
+         * @param timestamp
+         * @param data
+         * @return bool False when the envelope is larger than the ring
+         */
+        bool append(std::int64_t timestamp, std::string_view data);
+
+        /**
+         * Get Since Sequence
+         *
+         * @param sequence Last sequence received by the client
+         * @param now
+         * @return vector<shared_ptr<string const>>
+         */
+        std::vector<std::shared_ptr<std::string const> > get_since_sequence(std::uint64_t sequence,
+                                                                           std::int64_t now) const;
+
+        /**
+         * Get Since Timestamp
+         *
+         * @param timestamp
+         * @param now
+         * @return vector<shared_ptr<string const>>
+         */
+        std::vector<std::shared_ptr<std::string const> > get_since_timestamp(std::int64_t timestamp,
+                                                                            std::int64_t now) const;
+
+        /**
+         * Get Size
+         *
+         * @return size_t
+         */
+        std::size_t get_size() const;
+
+        /**
+         * Get Bytes
+         *
+         * @return size_t
+         */
+        std::size_t get_bytes() const;
+
+        /**
+         * Get Mutex
+         *
+         * Held by the State while appending and delivering so replays and live messages keep their order.
+         *
+         * @return mutex
+         */
+        std::mutex &get_mutex();
+
+    private:
+        /**
+         * Buffer
+         */
+        std::vector<char> buffer_;
+
+        /**
+         * Entries
+         */
+        std::vector<entry> entries_;
+
+        /**
+         * Age
+         */
+        std::int64_t age_;
+
+        /**
+         * First
+         */
+        std::size_t first_ = 0;
+
+        /**
+         * Count
+         */
+        std::size_t count_ = 0;
+
+        /**
+         * Head
+         *
+         * Next write offset in the buffer.
+         */
+        std::size_t head_ = 0;
+
+        /**
+         * Bytes
+         */
+        std::size_t bytes_ = 0;
+
+        /**
+         * Next Sequence
+         */
+        std::uint64_t next_sequence_ = 1;
+
+        /**
+         * Mutex
+         */
+        std::mutex mutex_;
+
+        /**
+         * Evict Expired
+         *
+         * @param now
+         */
+        void evict_expired(std::int64_t now);
+
+        /**
+         * Pop
+         */
+        void pop();
+
+        /**
+         * Get Entry
+         *
+         * @param index Position starting from the oldest entry
+         * @return entry
+         */
+        const entry &get_entry(std::size_t index) const;
+
+        /**
+         * Copy From
+         *
+         * @param index Position of the first entry to copy
+         * @param now
+         * @return vector<shared_ptr<string const>>
+         */
+        std::vector<std::shared_ptr<std::string const> > copy_from(std::size_t index, std::int64_t now) const;
+    };
+} // namespace engine
+
+#endif  // ENGINE_CHANNEL_HISTORY_HPP
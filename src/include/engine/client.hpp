@@ -6,13 +6,25 @@
 #ifndef ENGINE_CLIENT_HPP
 #define ENGINE_CLIENT_HPP
 
+#include <engine/tls_stream.hpp>
+#include <engine/rate_limiter.hpp>
+#include <engine/outbound_queue.hpp>
+#include <engine/response_sequencer.hpp>
+#include <engine/reliable_buffer.hpp>
+
 #include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
 #include <boost/uuid/uuid.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
 #include <boost/json/object.hpp>
 
 #include <boost/beast/core.hpp>
 #include <boost/beast/websocket.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/beast/http/string_body.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <boost/asio/ssl/stream.hpp>
 
@@ -46,6 +58,11 @@ namespace engine {
          */
         bool is_local_;
 
+        /**
+         * Limiter
+         */
+        rate_limiter limiter_;
+
     public:
         /**
          * Construct
@@ -81,7 +98,7 @@ namespace engine {
          *
          * @return tcp::socket
          */
-        std::optional<boost::beast::websocket::stream<boost::asio::ssl::stream<boost::beast::tcp_stream>>> &get_socket();
+        std::optional<boost::beast::websocket::stream<tls_stream>> &get_socket();
 
         /**
          * Get Is Local
@@ -99,8 +116,47 @@ namespace engine {
          * Send
          *
          * @param data
+         * @param priority
          */
-        void send(std::shared_ptr<std::string const> const &data);
+        void send(std::shared_ptr<std::string const> const &data, priority priority = bulk);
+
+        /**
+         * Publish
+         *
+         * Sends a publish envelope, conflated with the undelivered one of the channel when the channel or the
+         * subscription opted in.
+         *
+         * @param data
+         * @param channel
+         */
+        void publish(std::shared_ptr<std::string const> const &data, std::shared_ptr<std::string const> const &channel);
+
+        /**
+         * Set Conflated
+         *
+         * @param channel
+         * @param conflated
+         */
+        void set_conflated(const std::string &channel, bool conflated);
+
+        /**
+         * Set Reliable
+         *
+         * Frames the following bulk deliveries with a sequence and keeps them until confirmed.
+         *
+         * @param buffer
+         * @param redeliver Sends the unconfirmed deliveries of a resumed buffer first
+         */
+        void set_reliable(std::shared_ptr<reliable_buffer> buffer, bool redeliver);
+
+        /**
+         * Drain
+         *
+         * Sends the hint and closes the connection once the outbound queue is flushed.
+         *
+         * @param hint
+         */
+        void drain(std::shared_ptr<std::string const> const &hint);
 
         /**
          * Set Socket
@@ -109,27 +165,75 @@ namespace engine {
          */
         void set_socket(boost::asio::ip::tcp::socket &&socket);
 
+        /**
+         * Set Local Socket
+         *
+         * @param socket
+         */
+        void set_local_socket(boost::asio::local::stream_protocol::socket &&socket);
+
     private:
         /**
          * Socket
          */
-        std::optional<boost::beast::websocket::stream<boost::asio::ssl::stream<boost::beast::tcp_stream>>> socket_;
+        std::optional<boost::beast::websocket::stream<tls_stream>> socket_;
+
+        /**
+         * Local Socket
+         */
+        std::optional<boost::beast::websocket::stream<boost::asio::local::stream_protocol::socket>> local_socket_;
 
         /**
          * Buffer
          */
         boost::beast::flat_buffer buffer_;
 
+        /**
+         * Upgrade Request
+         */
+        boost::beast::http::request<boost::beast::http::string_body> upgrade_request_;
+
         /**
          * Queue
          */
-        std::vector<std::shared_ptr<std::string const> > queue_;
+        outbound_queue queue_;
+
+        /**
+         * Replies
+         *
+         * Keeps the replies in request order while a handler is suspended.
+         */
+        response_sequencer replies_;
 
         /**
          * TLS Shutdown Started
          */
         std::atomic<bool> tls_shutdown_started_{false};
 
+        /**
+         * Draining
+         */
+        std::atomic<bool> draining_{false};
+
+        /**
+         * Closing
+         */
+        bool closing_ = false;
+
+        /**
+         * Conflated
+         *
+         * Channels subscribed with conflation, only touched from the strand of the client.
+         */
+        std::unordered_set<std::string> conflated_;
+
+        /**
+         * Reliable
+         *
+         * Retransmit buffer while in reliable mode, only touched from the strand of the client.
+         */
+        std::shared_ptr<reliable_buffer> reliable_;
+
         /**
         * On Run
         */
@@ -160,8 +264,57 @@ namespace engine {
          * On Send
          *
          * @param data
+         * @param priority
+         */
+        void on_send(std::shared_ptr<std::string const> const &data, priority priority);
+
+        /**
+         * On Reply
+         *
+         * @param slot
+         * @param message
          */
-        void on_send(std::shared_ptr<std::string const> const &data);
+        void on_reply(std::uint64_t slot, std::shared_ptr<std::string const> message);
+
+        /**
+         * Get Executor
+         *
+         * @return any_io_executor Strand of the socket in use
+         */
+        boost::asio::any_io_executor get_executor();
+
+        /**
+         * On Publish
+         *
+         * @param data
+         * @param channel
+         */
+        void on_publish(std::shared_ptr<std::string const> const &data, std::shared_ptr<std::string const> const &channel);
+
+        /**
+         * On Set Conflated
+         *
+         * @param channel
+         * @param conflated
+         */
+        void on_set_conflated(const std::string &channel, bool conflated);
+
+        /**
+         * On Set Reliable
+         *
+         * @param buffer
+         * @param redeliver
+         */
+        void on_set_reliable(const std::shared_ptr<reliable_buffer> &buffer, bool redeliver);
+
+        /**
+         * Enqueue
+         *
+         * @param data
+         * @param priority
+         * @param key
+         */
+        void enqueue(std::shared_ptr<std::string const> const &data, priority priority, std::string_view key);
 
         /**
          * On Write
@@ -171,6 +324,23 @@ namespace engine {
          */
         void on_write(const boost::beast::error_code &ec, std::size_t bytes_transferred);
 
+        /**
+         * Do Write
+         */
+        void do_write();
+
+        /**
+         * Do Close
+         */
+        void do_close();
+
+        /**
+         * On Close
+         *
+         * @param ec
+         */
+        void on_close(const boost::beast::error_code &ec);
+
         /**
          * On Handshake
          *
@@ -178,6 +348,19 @@ namespace engine {
          */
         void on_handshake(const boost::beast::error_code &ec);
 
+        /**
+         * On Upgrade Request
+         *
+         * @param ec
+         * @param bytes_transferred
+         */
+        void on_upgrade_request(const boost::beast::error_code &ec, std::size_t bytes_transferred);
+
+        /**
+         * Do Accept
+         */
+        void do_accept();
+
         /**
          * Do TLS Shutdown
          */
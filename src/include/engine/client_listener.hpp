@@ -28,6 +28,8 @@ namespace engine {
         void do_accept();
 
         void start();
+
+        void stop();
     };
 } // namespace engine
 
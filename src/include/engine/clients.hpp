@@ -11,6 +11,7 @@
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/composite_key.hpp>
 
 #include <boost/uuid/uuid.hpp>
@@ -46,7 +47,7 @@ namespace engine {
                 tag<clients_by_session>,
                 const_mem_fun<client, boost::uuids::uuid, &client::get_session_id>
             >,
-            ordered_unique<
+            hashed_unique<
                 tag<clients_by_client>,
                 const_mem_fun<client, boost::uuids::uuid, &client::get_id>
             >,
@@ -26,6 +26,11 @@ namespace engine {
          */
         std::atomic<unsigned short> clients_port_ = 12000;
 
+        /**
+         * Clients Socket Path
+         */
+        std::string clients_socket_path_;
+
         /**
          * Is Node
          */
@@ -51,6 +56,280 @@ namespace engine {
          */
         unsigned short threads_ = 1;
 
+        /**
+         * Handshake Threads
+         */
+        unsigned short handshake_threads_ = 0;
+
+        /**
+         * Session Lanes
+         */
+        unsigned short session_lanes_ = 1;
+
+        /**
+         * Topology
+         *
+         * mesh: every State connects to every other State.
+         * tree: every State only keeps the session it joined through and the ones joined through it.
+         */
+        std::string topology_ = "mesh";
+
+        /**
+         * Relay Max Hops
+         */
+        unsigned short relay_max_hops_ = 16;
+
+        /**
+         * Session Batch Messages
+         *
+         * Max envelopes packed on a single frame between States (1: disabled).
+         */
+        std::size_t session_batch_messages_ = 1;
+
+        /**
+         * Session Batch Bytes
+         */
+        std::size_t session_batch_bytes_ = 65536;
+
+        /**
+         * Session Batch Delay
+         *
+         * Microseconds a batch waits for more envelopes before being flushed.
+         */
+        std::size_t session_batch_delay_ = 200;
+
+        /**
+         * Peer Retention
+         *
+         * Seconds the clients and subscriptions of a lost peer are kept for a digest based resync (0: disabled).
+         */
+        unsigned short peer_retention_ = 30;
+
+        /**
+         * Session Heartbeat Interval
+         *
+         * Milliseconds between pings sent to each peer (0: disabled).
+         */
+        std::size_t session_heartbeat_interval_ = 1000;
+
+        /**
+         * Session Heartbeat Misses
+         *
+         * Intervals without hearing from a peer before it is considered dead.
+         */
+        unsigned short session_heartbeat_misses_ = 3;
+
+        /**
+         * Load Report Interval
+         *
+         * Milliseconds between load reports sent to peers (0: disabled).
+         */
+        std::size_t load_report_interval_ = 1000;
+
+        /**
+         * Load Threshold
+         *
+         * Local clients above which new clients are redirected to the least loaded peer (0: disabled).
+         */
+        std::size_t load_threshold_ = 0;
+
+        /**
+         * Drain Deadline
+         *
+         * Milliseconds a drain waits for clients to leave and queues to flush before stopping.
+         */
+        std::size_t drain_deadline_ = 10000;
+
+        /**
+         * Dedup TTL
+         *
+         * Milliseconds a transaction id received from a peer is remembered to drop duplicates (0: disabled), the
+         * window assumes clients never reuse a transaction id for the same action and channel.
+         */
+        std::size_t dedup_ttl_ = 0;
+
+        /**
+         * Dedup Capacity
+         *
+         * Transaction ids remembered per half TTL, bounds the memory of the window.
+         */
+        std::size_t dedup_capacity_ = 65536;
+
+        /**
+         * History Messages
+         *
+         * Envelopes kept per channel to replay on subscribe (0: disabled).
+         */
+        std::size_t history_messages_ = 0;
+
+        /**
+         * History Bytes
+         *
+         * Bytes reserved per channel for the serialized envelopes.
+         */
+        std::size_t history_bytes_ = 1048576;
+
+        /**
+         * History Age
+         *
+         * Milliseconds an envelope is kept in the channel history (0: unlimited).
+         */
+        std::size_t history_age_ = 60000;
+
+        /**
+         * Last Value Channels
+         *
+         * Channels whose most recent envelope is kept and sent on subscribe (0: disabled).
+         */
+        std::size_t last_value_channels_ = 0;
+
+        /**
+         * Client Rate Limit
+         *
+         * Messages per second accepted from a client (0: unlimited).
+         */
+        std::size_t client_rate_limit_ = 0;
+
+        /**
+         * Fan Out Rate Limit
+         *
+         * Broadcast, publish and send messages per second accepted from a client (0: unlimited).
+         */
+        std::size_t fanout_rate_limit_ = 0;
+
+        /**
+         * Channel Rate Limit
+         *
+         * Publish messages per second accepted on a channel across all local clients (0: unlimited).
+         */
+        std::size_t channel_rate_limit_ = 0;
+
+        /**
+         * Rate Limit Burst
+         *
+         * Messages accepted at once above the rate limits.
+         */
+        std::size_t rate_limit_burst_ = 20;
+
+        /**
+         * Queue Control Weight
+         *
+         * Control messages written in a row while bulk messages wait on an outbound queue (0: strict priority).
+         */
+        std::size_t queue_control_weight_ = 4;
+
+        /**
+         * Conflated Channels
+         *
+         * Comma separated channels whose undelivered publish is replaced by the newest one for every client.
+         */
+        std::string conflated_channels_;
+
+        /**
+         * Batch Max Requests
+         *
+         * Sub requests accepted by a single batch request.
+         */
+        std::size_t batch_max_requests_ = 1000;
+
+        /**
+         * Worker Threads
+         *
+         * Threads running heavy client actions (0: inline on the connection).
+         */
+        unsigned short worker_threads_ = 0;
+
+        /**
+         * Worker Queue Capacity
+         *
+         * Heavy actions waiting or running at once before new ones are refused.
+         */
+        std::size_t worker_queue_capacity_ = 1024;
+
+        /**
+         * Publish Log Path
+         *
+         * Directory of the persistent publish log of every channel, requires the history (empty: disabled).
+         */
+        std::string publish_log_path_;
+
+        /**
+         * Publish Log Segment Bytes
+         *
+         * Size of each memory mapped segment file.
+         */
+        std::size_t publish_log_segment_bytes_ = 16777216;
+
+        /**
+         * Publish Log Segments
+         *
+         * Segments kept per channel, the oldest one is removed when a new one is created.
+         */
+        std::size_t publish_log_segments_ = 4;
+
+        /**
+         * Publish Log Fsync
+         *
+         * When appended envelopes are flushed to disk: never, interval or always.
+         */
+        std::string publish_log_fsync_ = "interval";
+
+        /**
+         * Publish Log Fsync Interval
+         *
+         * Milliseconds between group commits under the interval policy.
+         */
+        std::size_t publish_log_fsync_interval_ = 100;
+
+        /**
+         * Publish Log Replay Bytes
+         *
+         * Max bytes a single replay reads from the publish log, a larger gap is resumed with a new subscribe.
+         */
+        std::size_t publish_log_replay_bytes_ = 1048576;
+
+        /**
+         * Snapshot Path
+         *
+         * File holding the clients and subscriptions of the peers, loaded on start (empty: disabled).
+         */
+        std::string snapshot_path_;
+
+        /**
+         * Snapshot Interval
+         *
+         * Milliseconds between snapshots, one is also written on stop (0: only on stop).
+         */
+        std::size_t snapshot_interval_ = 5000;
+
+        /**
+         * Reliable Messages
+         *
+         * Unconfirmed deliveries kept per client in reliable mode (0: reliable mode disabled).
+         */
+        std::size_t reliable_messages_ = 1024;
+
+        /**
+         * Reliable Bytes
+         *
+         * Bytes of unconfirmed deliveries kept per client in reliable mode.
+         */
+        std::size_t reliable_bytes_ = 1048576;
+
+        /**
+         * Reliable Retention
+         *
+         * Seconds the unconfirmed deliveries of a disconnected client wait for it to resume.
+         */
+        unsigned short reliable_retention_ = 60;
+
+        /**
+         * Reliable Orphans
+         *
+         * Disconnected clients whose unconfirmed deliveries are kept at once, the oldest are dropped first.
+         */
+        std::size_t reliable_orphans_ = 1024;
+
         /**
          * Registered
          */
@@ -130,6 +409,11 @@ namespace engine {
          * SSL Client Listener Password
          */
         std::string ssl_client_listener_password_ = "36e422f3";
+
+        /**
+         * SSL Kernel TLS Enabled
+         */
+        bool ssl_ktls_enabled_ = false;
     };
 } // namespace engine
 
@@ -0,0 +1,21 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_COST_HPP
+#define ENGINE_COST_HPP
+
+namespace engine {
+    /**
+     * Cost
+     *
+     * CPU class of an action, heavy actions of clients run on the worker pool.
+     */
+    enum cost {
+        light,
+        heavy
+    };
+} // namespace engine
+
+#endif  // ENGINE_COST_HPP
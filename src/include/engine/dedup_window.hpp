@@ -0,0 +1,207 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_DEDUP_WINDOW_HPP
+#define ENGINE_DEDUP_WINDOW_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace engine {
+    /**
+     * Dedup Window
+     *
+     * Fixed memory set of 128-bit identifiers seen during the last TTL. Each shard keeps two open addressing
+     * generations, inserts go to the current one and lookups check both; the current generation becomes the
+     * previous one every half TTL or when it is half full. An identifier is remembered for at most one TTL,
+     * and for at least half of it unless the window is saturated.
+     */
+    class dedup_window {
+    public:
+        /**
+         * Key
+         */
+        struct key {
+            /**
+             * High
+             */
+            std::uint64_t high_ = 0;
+
+            /**
+             * Low
+             */
+            std::uint64_t low_ = 0;
+
+            /**
+             * Equal
+             *
+             * @param other
+             * @return bool
+             */
+            bool operator==(const key &other) const = default;
+        };
+
+        /**
+         * Shards
+         */
+        static constexpr std::size_t shards = 16;
+
+        /**
+         * Constructor
+         *
+         * @param capacity Identifiers kept per generation across all shards
+         * @param ttl
+         */
+        dedup_window(std::size_t capacity, std::chrono::steady_clock::duration ttl);
+
+        /**
+         * Make Key
+         *
+         * Parses the textual form of an uuid without allocating.
+         *
+         * @param id
+         * @return optional<key>
+         */
+        static std::optional<key> make_key(std::string_view id);
+
+        /**
+         * Insert
+         *
+         * @param key
+         * @param now
+         * @return bool False when the key was already seen inside the window
+         */
+        bool insert(const key &key, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+        /**
+         * Get Hits
+         *
+         * @return uint64_t
+         */
+        std::uint64_t get_hits() const;
+
+        /**
+         * Get Misses
+         *
+         * @return uint64_t
+         */
+        std::uint64_t get_misses() const;
+
+        /**
+         * Get Slots
+         *
+         * @return size_t Slots per generation of each shard
+         */
+        std::size_t get_slots() const;
+
+    private:
+        /**
+         * Generation
+         */
+        struct generation {
+            /**
+             * Slots
+             */
+            std::vector<key> slots_;
+
+            /**
+             * Size
+             */
+            std::size_t size_ = 0;
+        };
+
+        /**
+         * Shard
+         */
+        struct shard {
+            /**
+             * Mutex
+             */
+            std::mutex mutex_;
+
+            /**
+             * Generations
+             */
+            std::array<generation, 2> generations_;
+
+            /**
+             * Current
+             */
+            std::size_t current_ = 0;
+
+            /**
+             * Rotated At
+             */
+            std::chrono::steady_clock::time_point rotated_at_;
+
+            /**
+             * Previous At
+             *
+             * Time the previous generation started receiving identifiers.
+             */
+            std::chrono::steady_clock::time_point previous_at_;
+
+            /**
+             * Hits
+             */
+            std::atomic<std::uint64_t> hits_{0};
+
+            /**
+             * Misses
+             */
+            std::atomic<std::uint64_t> misses_{0};
+        };
+
+        /**
+         * Contains
+         *
+         * @param generation
+         * @param key
+         * @param hash
+         * @return bool
+         */
+        bool contains(const generation &generation, const key &key, std::uint64_t hash) const;
+
+        /**
+         * Emplace
+         *
+         * @param generation
+         * @param key
+         * @param hash
+         */
+        void emplace(generation &generation, const key &key, std::uint64_t hash) const;
+
+        /**
+         * Rotate
+         *
+         * @param shard
+         * @param now
+         */
+        void rotate(shard &shard, std::chrono::steady_clock::time_point now) const;
+
+        /**
+         * Mask
+         */
+        std::size_t mask_;
+
+        /**
+         * TTL
+         */
+        std::chrono::steady_clock::duration ttl_;
+
+        /**
+         * Shards
+         */
+        std::array<shard, shards> shards_;
+    };
+} // namespace engine
+
+#endif  // ENGINE_DEDUP_WINDOW_HPP
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_DIGEST_HPP
+#define ENGINE_DIGEST_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <boost/json/array.hpp>
+#include <boost/uuid/uuid.hpp>
+
+namespace engine {
+    /**
+     * Digest
+     *
+     * Bucketed hash of a set of clients and subscriptions. Entries are placed by client so a client and its
+     * subscriptions always share a bucket, and combined with XOR so the order of insertion doesn't matter.
+     */
+    class digest {
+    public:
+        /**
+         * Buckets
+         */
+        static constexpr std::size_t buckets = 64;
+
+        /**
+         * Get Bucket
+         *
+         * @param client_id
+         * @return size_t
+         */
+        static std::size_t get_bucket(const boost::uuids::uuid &client_id);
+
+        /**
+         * Add Client
+         *
+         * @param client_id
+         */
+        void add_client(const boost::uuids::uuid &client_id);
+
+        /**
+         * Add Subscription
+         *
+         * @param client_id
+         * @param channel
+         */
+        void add_subscription(const boost::uuids::uuid &client_id, std::string_view channel);
+
+        /**
+         * Compare
+         *
+         * @param other
+         * @return vector<size_t> Buckets that don't match
+         */
+        std::vector<std::size_t> compare(const digest &other) const;
+
+        /**
+         * To Array
+         *
+         * @return array
+         */
+        boost::json::array to_array() const;
+
+        /**
+         * From Array
+         *
+         * @param array
+         * @return optional<digest>
+         */
+        static std::optional<digest> from_array(const boost::json::array &array);
+
+    private:
+        /**
+         * Hashes
+         */
+        std::array<std::int64_t, buckets> hashes_{};
+    };
+} // namespace engine
+
+#endif  // ENGINE_DIGEST_HPP
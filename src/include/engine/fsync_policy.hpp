@@ -0,0 +1,22 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_FSYNC_POLICY_HPP
+#define ENGINE_FSYNC_POLICY_HPP
+
+namespace engine {
+    /**
+     * Fsync Policy
+     *
+     * When the publish log flushes its mapped segments to disk.
+     */
+    enum fsync_policy {
+        fsync_never,
+        fsync_interval,
+        fsync_always
+    };
+} // namespace engine
+
+#endif  // ENGINE_FSYNC_POLICY_HPP
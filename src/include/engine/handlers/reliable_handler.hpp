@@ -0,0 +1,25 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_HANDLERS_RELIABLE_HANDLER_HPP
+#define ENGINE_HANDLERS_RELIABLE_HANDLER_HPP
+
+namespace engine {
+    /**
+     * Forward Request
+     */
+    struct request;
+
+    namespace handlers {
+        /**
+         * Reliable Handler
+         *
+         * @param request
+         */
+        void reliable_handler(const request &request);
+    }
+} // namespace engine
+
+#endif  // ENGINE_HANDLERS_RELIABLE_HANDLER_HPP
@@ -6,19 +6,24 @@
 #ifndef ENGINE_HANDLERS_SESSION_HANDLER_HPP
 #define ENGINE_HANDLERS_SESSION_HANDLER_HPP
 
+#include <boost/asio/awaitable.hpp>
+
 namespace engine {
     /**
-     * Forward Request
+     * Forward Async Request
      */
-    struct request;
+    struct async_request;
 
     namespace handlers {
         /**
          * Session Handler
          *
+         * Resolves and connects to the announced session without blocking the strand of the connection.
+         *
          * @param request
+         * @return awaitable<void>
          */
-        void session_handler(const request &request);
+        boost::asio::awaitable<void> session_handler(async_request request);
     }
 } // namespace engine
 
@@ -6,6 +6,8 @@
 #ifndef ENGINE_HANDLERS_UNSUBSCRIBE_HANDLER_HPP
 #define ENGINE_HANDLERS_UNSUBSCRIBE_HANDLER_HPP
 
+#include <string>
+
 namespace engine {
     /**
      * Forward Request
@@ -19,6 +21,17 @@ namespace engine {
          * @param request
          */
         void unsubscribe_handler(const request &request);
+
+        /**
+         * On Unsubscribed
+         *
+         * Clears the options of a client subscription and replies.
+         *
+         * @param request
+         * @param channel
+         * @param success
+         */
+        void on_unsubscribed(const request &request, const std::string &channel, bool success);
     }
 } // namespace engine
 
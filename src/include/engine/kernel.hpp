@@ -8,8 +8,10 @@
 
 #include <engine/kernel_context.hpp>
 
+#include <boost/asio/any_io_executor.hpp>
 #include <boost/json/object.hpp>
 #include <boost/uuid/uuid.hpp>
+#include <functional>
 #include <memory>
 
 namespace engine {
@@ -33,17 +35,38 @@ namespace engine {
      */
     class response;
 
+    /**
+     * Forward Rate Limiter
+     */
+    class rate_limiter;
+
+    /**
+     * Kernel Completion
+     *
+     * Receives the response of a deferred request on the executor given to the kernel.
+     */
+    using kernel_completion = std::function<void(const std::shared_ptr<response> &)>;
+
     /**
      * Kernel
      *
+     * Handlers that suspend are spawned on the executor of the connection and their response is marked as
+     * deferred, the completion receives it once processed. Without executor the kernel waits for them.
+     *
      * @param state
      * @param data
      * @param context
      * @param entity_id
+     * @param limiter Buckets of the client, checked before dispatch
+     * @param executor Strand of the connection
+     * @param completion
      * @return shared_ptr<response>
      */
     std::shared_ptr<response> kernel(const std::shared_ptr<state> &state,
-                                     const boost::json::object &data, kernel_context context, boost::uuids::uuid entity_id);
+                                     const boost::json::object &data, kernel_context context, boost::uuids::uuid entity_id,
+                                     rate_limiter *limiter = nullptr,
+                                     const boost::asio::any_io_executor &executor = {},
+                                     const kernel_completion &completion = nullptr);
 } // namespace engine
 
 #endif  // ENGINE_KERNEL_HPP
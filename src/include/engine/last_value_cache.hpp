@@ -0,0 +1,75 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_LAST_VALUE_CACHE_HPP
+#define ENGINE_LAST_VALUE_CACHE_HPP
+
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace engine {
+    /**
+     * Last Value Cache
+     *
+     * Most recent serialized publish envelope per channel. Slots are created once per channel and never
+     * removed, so updates only swap the pointer of an existing slot.
+     */
+    class last_value_cache {
+    public:
+        /**
+         * Store
+         *
+         * @param channel
+         * @param value
+         * @param channels Maximum number of channels, new channels beyond it are not cached
+         * @return bool
+         */
+        bool store(const std::string &channel, std::shared_ptr<std::string const> value, std::size_t channels);
+
+        /**
+         * Load
+         *
+         * @param channel
+         * @return shared_ptr<string const> Null when the channel has no value
+         */
+        std::shared_ptr<std::string const> load(const std::string &channel) const;
+
+        /**
+         * Get Size
+         *
+         * @return size_t
+         */
+        std::size_t get_size() const;
+
+    private:
+        /**
+         * Slot
+         */
+        using slot = std::atomic<std::shared_ptr<std::string const> >;
+
+        /**
+         * Slots
+         */
+        std::unordered_map<std::string, std::unique_ptr<slot> > slots_;
+
+        /**
+         * Slots Shared Mutex
+         */
+        mutable std::shared_mutex slots_mutex_;
+
+        /**
+         * Find
+         *
+         * @param channel
+         * @return slot
+         */
+        slot *find(const std::string &channel) const;
+    };
+} // namespace engine
+
+#endif  // ENGINE_LAST_VALUE_CACHE_HPP
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_LATENCY_METER_HPP
+#define ENGINE_LATENCY_METER_HPP
+
+#include <engine/queue_latency.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace engine {
+    /**
+     * Latency Meter
+     *
+     * Lock free count, total and max of a measured duration.
+     */
+    class latency_meter {
+    public:
+        /**
+         * Record
+         *
+         * @param duration
+         */
+        void record(std::chrono::steady_clock::duration duration);
+
+        /**
+         * Get
+         *
+         * @return queue_latency
+         */
+        queue_latency get() const;
+
+    private:
+        /**
+         * Count
+         */
+        std::atomic<std::uint64_t> count_ = 0;
+
+        /**
+         * Total
+         *
+         * Microseconds.
+         */
+        std::atomic<std::uint64_t> total_ = 0;
+
+        /**
+         * Max
+         *
+         * Microseconds.
+         */
+        std::atomic<std::uint64_t> max_ = 0;
+    };
+} // namespace engine
+
+#endif  // ENGINE_LATENCY_METER_HPP
@@ -0,0 +1,44 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_LOAD_HPP
+#define ENGINE_LOAD_HPP
+
+#include <cstddef>
+
+namespace engine {
+    /**
+     * Load
+     *
+     * Load vector gossiped between States to balance new clients.
+     */
+    struct load {
+        /**
+         * Clients
+         */
+        std::size_t clients_ = 0;
+
+        /**
+         * Rate
+         *
+         * Messages per second received from clients.
+         */
+        double rate_ = 0;
+
+        /**
+         * Queued
+         *
+         * Messages waiting on outbound queues.
+         */
+        std::size_t queued_ = 0;
+
+        /**
+         * Draining
+         */
+        bool draining_ = false;
+    };
+} // namespace engine
+
+#endif  // ENGINE_LOAD_HPP
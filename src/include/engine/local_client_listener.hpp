@@ -0,0 +1,99 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_LOCAL_CLIENT_LISTENER_HPP
+#define ENGINE_LOCAL_CLIENT_LISTENER_HPP
+
+#include <memory>
+#include <string>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/beast/core.hpp>
+
+namespace engine {
+    /**
+     * Forward State
+     */
+    class state;
+
+    /**
+     * Local Client Listener
+     *
+     * Accepts plaintext websocket clients over a Unix domain socket. Trust comes from the
+     * socket file permissions and the peer credentials.
+     */
+    class local_client_listener : public std::enable_shared_from_this<local_client_listener> {
+        /**
+         * IO Context
+         */
+        boost::asio::io_context &ioc_;
+
+        /**
+         * Acceptor
+         */
+        boost::asio::local::stream_protocol::acceptor acceptor_;
+
+        /**
+         * State
+         */
+        std::shared_ptr<state> state_;
+
+        /**
+         * Path
+         */
+        std::string path_;
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param ioc
+         * @param path
+         * @param state
+         */
+        local_client_listener(boost::asio::io_context &ioc, const std::string &path,
+                              const std::shared_ptr<state> &state);
+
+        /**
+         * Destructor
+         */
+        ~local_client_listener();
+
+        /**
+         * On Accept
+         *
+         * @param ec
+         * @param socket
+         */
+        void on_accept(const boost::beast::error_code &ec, boost::asio::local::stream_protocol::socket socket);
+
+        /**
+         * Do Accept
+         */
+        void do_accept();
+
+        /**
+         * Start
+         */
+        void start();
+
+        /**
+         * Stop
+         */
+        void stop();
+
+    private:
+        /**
+         * Is Trusted
+         *
+         * @param socket
+         * @return bool
+         */
+        static bool is_trusted(boost::asio::local::stream_protocol::socket &socket);
+    };
+} // namespace engine
+
+#endif  // ENGINE_LOCAL_CLIENT_LISTENER_HPP
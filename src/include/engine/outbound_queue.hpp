@@ -0,0 +1,156 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_OUTBOUND_QUEUE_HPP
+#define ENGINE_OUTBOUND_QUEUE_HPP
+
+#include <engine/priority.hpp>
+#include <engine/string_hash.hpp>
+
+#include <array>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace engine {
+    /**
+     * Outbound Queue
+     *
+     * Per priority FIFOs of a connection. Control messages go first, but after weight consecutive control
+     * messages a waiting bulk message is written so data keeps flowing. Bulk messages pushed with a key are
+     * conflated, a newer message with the same key replaces the undelivered one. Not thread safe, used from
+     * the strand of the connection.
+     */
+    class outbound_queue {
+    public:
+        /**
+         * Item
+         */
+        struct item {
+            /**
+             * Data
+             */
+            std::shared_ptr<std::string const> data_;
+
+            /**
+             * Priority
+             */
+            priority priority_ = bulk;
+
+            /**
+             * Queued At
+             */
+            std::chrono::steady_clock::time_point queued_at_;
+
+            /**
+             * Key
+             *
+             * Conflation key, empty when the message is never replaced.
+             */
+            std::string key_;
+        };
+
+        /**
+         * Constructor
+         *
+         * @param weight Control messages written in a row while bulk messages wait (0: strict priority)
+         */
+        explicit outbound_queue(std::size_t weight = 0);
+
+        /**
+         * Push
+         *
+         * @param data
+         * @param priority
+         * @param now
+         * @param key Conflation key of a bulk message
+         * @return bool True when no write is in flight and the writer must be started
+         */
+        bool push(std::shared_ptr<std::string const> data, priority priority,
+                  std::chrono::steady_clock::time_point now, std::string_view key = {});
+
+        /**
+         * Replace
+         *
+         * Swaps the data of the undelivered bulk message with the same key, it keeps its place in the queue.
+         *
+         * @param key
+         * @param data
+         * @return bool False when no undelivered message has the key
+         */
+        bool replace(std::string_view key, std::shared_ptr<std::string const> data);
+
+        /**
+         * Next
+         *
+         * Moves the next message to the in flight slot, it stays alive until complete.
+         *
+         * @return item Null when there is nothing to write
+         */
+        const item *next();
+
+        /**
+         * Complete
+         */
+        void complete();
+
+        /**
+         * Empty
+         *
+         * @return bool True when nothing waits to be written
+         */
+        bool empty() const;
+
+        /**
+         * Size
+         *
+         * @return size_t Waiting messages plus the one in flight
+         */
+        std::size_t size() const;
+
+    private:
+        /**
+         * Items
+         */
+        std::array<std::deque<item>, 2> items_;
+
+        /**
+         * Keys
+         *
+         * Conflation key to the absolute position of its message in the bulk queue.
+         */
+        std::unordered_map<std::string, std::uint64_t, string_hash, std::equal_to<> > keys_;
+
+        /**
+         * Bulk Front
+         *
+         * Absolute position of the first message in the bulk queue.
+         */
+        std::uint64_t bulk_front_ = 0;
+
+        /**
+         * Current
+         */
+        std::optional<item> current_;
+
+        /**
+         * Weight
+         */
+        std::size_t weight_;
+
+        /**
+         * Streak
+         *
+         * Control messages written in a row while bulk messages wait.
+         */
+        std::size_t streak_ = 0;
+    };
+} // namespace engine
+
+#endif  // ENGINE_OUTBOUND_QUEUE_HPP
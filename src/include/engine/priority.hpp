@@ -0,0 +1,21 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_PRIORITY_HPP
+#define ENGINE_PRIORITY_HPP
+
+namespace engine {
+    /**
+     * Priority
+     *
+     * Class of an outbound message, acks and control messages don't wait behind fan out payloads.
+     */
+    enum priority {
+        control,
+        bulk,
+    };
+} // namespace engine
+
+#endif  // ENGINE_PRIORITY_HPP
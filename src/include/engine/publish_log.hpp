@@ -0,0 +1,316 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_PUBLISH_LOG_HPP
+#define ENGINE_PUBLISH_LOG_HPP
+
+#include <engine/fsync_policy.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace engine {
+    /**
+     * Publish Log
+     *
+     * Append only log of the serialized envelopes published on a channel. Records are copied into fixed size
+     * segment files mapped in memory, a sparse index per segment locates them by sequence or timestamp and
+     * reads hand out views of the mapping. Dirty ranges are flushed to disk according to the fsync policy and
+     * the oldest segments are removed beyond the retention. Thread safe.
+     */
+    class publish_log {
+    public:
+        /**
+         * Record
+         */
+        struct record {
+            /**
+             * Sequence
+             */
+            std::uint64_t sequence_ = 0;
+
+            /**
+             * Timestamp
+             */
+            std::int64_t timestamp_ = 0;
+
+            /**
+             * Data
+             *
+             * View of the mapping, valid while the visitor runs.
+             */
+            std::string_view data_;
+        };
+
+        /**
+         * Visitor
+         */
+        using visitor = std::function<void(const record &)>;
+
+        /**
+         * Constructor
+         *
+         * Recovers the segments found in the directory, a torn tail is discarded.
+         *
+         * @param directory
+         * @param segment_bytes
+         * @param segments Segments kept, the oldest ones are removed
+         * @param policy
+         */
+        publish_log(std::filesystem::path directory, std::size_t segment_bytes, std::size_t segments,
+                    fsync_policy policy);
+
+        /**
+         * Destructor
+         */
+        ~publish_log();
+
+        publish_log(const publish_log &) = delete;
+
+        publish_log &operator=(const publish_log &) = delete;
+
+        /**
+         * Get Next Sequence
+         *
+         * @return uint64_t Sequence following the last record, 1 when empty
+         */
+        std::uint64_t get_next_sequence() const;
+
+        /**
+         * Append
+         *
+         * @param sequence
+         * @param timestamp
+         * @param data
+         * @return bool False when the record doesn't fit in a segment or the segment can't be created
+         */
+        bool append(std::uint64_t sequence, std::int64_t timestamp, std::string_view data);
+
+        /**
+         * Sync
+         *
+         * Flushes the records appended since the last sync, appends between syncs are committed as a group.
+         */
+        void sync();
+
+        /**
+         * Get Mutex
+         *
+         * Held by the State while numbering, appending and delivering on channels without history.
+         *
+         * @return mutex
+         */
+        std::mutex &get_mutex();
+
+        /**
+         * Read Since Sequence
+         *
+         * @param sequence Last sequence received
+         * @param visitor
+         * @param limit Bytes of data visited, the first record is always visited
+         * @return size_t Records visited
+         */
+        std::size_t read_since_sequence(std::uint64_t sequence, const visitor &visitor,
+                                        std::size_t limit = std::numeric_limits<std::size_t>::max()) const;
+
+        /**
+         * Read Since Timestamp
+         *
+         * @param timestamp
+         * @param visitor
+         * @param limit Bytes of data visited, the first record is always visited
+         * @return size_t Records visited
+         */
+        std::size_t read_since_timestamp(std::int64_t timestamp, const visitor &visitor,
+                                         std::size_t limit = std::numeric_limits<std::size_t>::max()) const;
+
+        /**
+         * Get Segments Count
+         *
+         * @return size_t
+         */
+        std::size_t get_segments_count() const;
+
+        /**
+         * Get Bytes
+         *
+         * @return size_t Bytes used by records in every segment
+         */
+        std::size_t get_bytes() const;
+
+    private:
+        /**
+         * Index Entry
+         */
+        struct index_entry {
+            /**
+             * Sequence
+             */
+            std::uint64_t sequence_ = 0;
+
+            /**
+             * Timestamp
+             */
+            std::int64_t timestamp_ = 0;
+
+            /**
+             * Offset
+             */
+            std::size_t offset_ = 0;
+        };
+
+        /**
+         * Segment
+         */
+        struct segment {
+            /**
+             * Path
+             */
+            std::filesystem::path path_;
+
+            /**
+             * File Descriptor
+             */
+            int fd_ = -1;
+
+            /**
+             * Data
+             */
+            char *data_ = nullptr;
+
+            /**
+             * Capacity
+             */
+            std::size_t capacity_ = 0;
+
+            /**
+             * Size
+             */
+            std::size_t size_ = 0;
+
+            /**
+             * Synced
+             */
+            std::size_t synced_ = 0;
+
+            /**
+             * Next Sequence
+             */
+            std::uint64_t next_sequence_ = 0;
+
+            /**
+             * Index
+             *
+             * One entry every index interval bytes, the first record is always indexed.
+             */
+            std::vector<index_entry> index_;
+
+            /**
+             * Indexed At
+             */
+            std::size_t indexed_at_ = 0;
+        };
+
+        /**
+         * Directory
+         */
+        std::filesystem::path directory_;
+
+        /**
+         * Segment Bytes
+         */
+        std::size_t segment_bytes_;
+
+        /**
+         * Segments Limit
+         */
+        std::size_t segments_limit_;
+
+        /**
+         * Policy
+         */
+        fsync_policy policy_;
+
+        /**
+         * Segments
+         */
+        std::deque<segment> segments_;
+
+        /**
+         * Next Sequence
+         */
+        std::uint64_t next_sequence_ = 1;
+
+        /**
+         * Mutex
+         */
+        mutable std::mutex mutex_;
+
+        /**
+         * Publish Mutex
+         */
+        std::mutex publish_mutex_;
+
+        /**
+         * Recover
+         *
+         * @param path
+         */
+        void recover(const std::filesystem::path &path);
+
+        /**
+         * Open Segment
+         *
+         * @param first_sequence
+         * @return bool
+         */
+        bool open_segment(std::uint64_t first_sequence);
+
+        /**
+         * Close Segment
+         *
+         * @param segment
+         */
+        static void close_segment(segment &segment);
+
+        /**
+         * Sync Segment
+         *
+         * @param segment
+         */
+        static void sync_segment(segment &segment);
+
+        /**
+         * Index Record
+         *
+         * @param segment
+         * @param sequence
+         * @param timestamp
+         * @param offset
+         */
+        static void index_record(segment &segment, std::uint64_t sequence, std::int64_t timestamp, std::size_t offset);
+
+        /**
+         * Read From
+         *
+         * @param position Segment to start from
+         * @param offset Offset in that segment
+         * @param accept Records before the first accepted one are skipped
+         * @param visitor
+         * @param limit
+         * @return size_t
+         */
+        std::size_t read_from(std::size_t position, std::size_t offset, const std::function<bool(const record &)> &accept,
+                              const visitor &visitor, std::size_t limit) const;
+    };
+} // namespace engine
+
+#endif  // ENGINE_PUBLISH_LOG_HPP
@@ -0,0 +1,40 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_QUEUE_LATENCY_HPP
+#define ENGINE_QUEUE_LATENCY_HPP
+
+#include <cstdint>
+
+namespace engine {
+    /**
+     * Queue Latency
+     *
+     * Time messages of a priority class waited on outbound queues before being written, also used for the time
+     * tasks waited and ran on the worker pool.
+     */
+    struct queue_latency {
+        /**
+         * Count
+         */
+        std::uint64_t count_ = 0;
+
+        /**
+         * Total
+         *
+         * Microseconds.
+         */
+        std::uint64_t total_ = 0;
+
+        /**
+         * Max
+         *
+         * Microseconds.
+         */
+        std::uint64_t max_ = 0;
+    };
+} // namespace engine
+
+#endif  // ENGINE_QUEUE_LATENCY_HPP
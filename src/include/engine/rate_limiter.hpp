@@ -0,0 +1,69 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_RATE_LIMITER_HPP
+#define ENGINE_RATE_LIMITER_HPP
+
+#include <engine/token_bucket.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+namespace engine {
+    /**
+     * Forward Config
+     */
+    struct config;
+
+    /**
+     * Rate Limiter
+     *
+     * Buckets of a single client, every action draws from the client bucket and broadcast, publish and send
+     * also draw from the fan out bucket.
+     */
+    class rate_limiter {
+    public:
+        /**
+         * Constructor
+         */
+        rate_limiter() = default;
+
+        /**
+         * Constructor
+         *
+         * @param config
+         */
+        explicit rate_limiter(const config &config);
+
+        /**
+         * Is Enabled
+         *
+         * @return bool
+         */
+        bool is_enabled() const;
+
+        /**
+         * Consume
+         *
+         * @param action
+         * @param now
+         * @return bool False when the action must be rejected
+         */
+        bool consume(std::string_view action, std::int64_t now);
+
+    private:
+        /**
+         * Client
+         */
+        token_bucket client_;
+
+        /**
+         * Fan Out
+         */
+        token_bucket fanout_;
+    };
+} // namespace engine
+
+#endif  // ENGINE_RATE_LIMITER_HPP
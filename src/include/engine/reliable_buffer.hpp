@@ -0,0 +1,215 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_RELIABLE_BUFFER_HPP
+#define ENGINE_RELIABLE_BUFFER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine {
+    /**
+     * Reliable Buffer
+     *
+     * Retransmit buffer of a client in reliable mode. Each delivery is framed with the next sequence of the
+     * client and kept until the client confirms it, confirmations are cumulative. The oldest unconfirmed
+     * deliveries are dropped beyond the message or byte limit, on resume the first sequence still kept tells
+     * the client about the gap. Only the holder of the secret token issued with the buffer can resume it.
+     */
+    class reliable_buffer {
+    public:
+        /**
+         * Constructor
+         *
+         * @param messages
+         * @param bytes
+         */
+        reliable_buffer(std::size_t messages, std::size_t bytes);
+
+        /**
+         * Push
+         *
+         * @param data Serialized envelope
+         * @return shared_ptr<string const> Envelope framed with its sequence
+         */
+        std::shared_ptr<std::string const> push(const std::shared_ptr<std::string const> &data);
+
+        /**
+         * Confirm
+         *
+         * @param sequence Last sequence received by the client
+         * @return size_t Deliveries released
+         */
+        std::size_t confirm(std::uint64_t sequence);
+
+        /**
+         * Get Unconfirmed
+         *
+         * @return vector<shared_ptr<string const>> Framed deliveries in sequence order
+         */
+        std::vector<std::shared_ptr<std::string const> > get_unconfirmed() const;
+
+        /**
+         * Get Next Sequence
+         *
+         * @return uint64_t
+         */
+        std::uint64_t get_next_sequence() const;
+
+        /**
+         * Get First Sequence
+         *
+         * @return uint64_t Oldest unconfirmed sequence kept, the next sequence when empty
+         */
+        std::uint64_t get_first_sequence() const;
+
+        /**
+         * Get Size
+         *
+         * @return size_t
+         */
+        std::size_t get_size() const;
+
+        /**
+         * Get Bytes
+         *
+         * @return size_t
+         */
+        std::size_t get_bytes() const;
+
+        /**
+         * Get Dropped
+         *
+         * @return uint64_t Deliveries dropped unconfirmed because of the limits
+         */
+        std::uint64_t get_dropped() const;
+
+        /**
+         * Release
+         *
+         * Marks the buffer as orphan once its client disconnects.
+         *
+         * @param now
+         */
+        void release(std::chrono::steady_clock::time_point now);
+
+        /**
+         * Adopt
+         *
+         * @return bool False when the buffer wasn't orphan
+         */
+        bool adopt();
+
+        /**
+         * Is Expired
+         *
+         * @param now
+         * @param retention
+         * @return bool True when orphan for longer than the retention
+         */
+        bool is_expired(std::chrono::steady_clock::time_point now, std::chrono::steady_clock::duration retention) const;
+
+        /**
+         * Get Released At
+         *
+         * @return optional<time_point> Empty while a client owns the buffer
+         */
+        std::optional<std::chrono::steady_clock::time_point> get_released_at() const;
+
+        /**
+         * Get Token
+         *
+         * @return string Secret required to resume the buffer
+         */
+        const std::string &get_token() const;
+
+        /**
+         * Is Token
+         *
+         * Compares in constant time.
+         *
+         * @param token
+         * @return bool
+         */
+        bool is_token(std::string_view token) const;
+
+    private:
+        /**
+         * Entry
+         */
+        struct entry {
+            /**
+             * Sequence
+             */
+            std::uint64_t sequence_ = 0;
+
+            /**
+             * Data
+             */
+            std::shared_ptr<std::string const> data_;
+        };
+
+        /**
+         * Entries
+         */
+        std::deque<entry> entries_;
+
+        /**
+         * Messages
+         */
+        std::size_t messages_;
+
+        /**
+         * Bytes Limit
+         */
+        std::size_t bytes_limit_;
+
+        /**
+         * Bytes
+         */
+        std::size_t bytes_ = 0;
+
+        /**
+         * Next Sequence
+         */
+        std::uint64_t next_sequence_ = 1;
+
+        /**
+         * Dropped
+         */
+        std::uint64_t dropped_ = 0;
+
+        /**
+         * Released At
+         *
+         * Empty while a client owns the buffer.
+         */
+        std::optional<std::chrono::steady_clock::time_point> released_at_;
+
+        /**
+         * Token
+         */
+        std::string token_;
+
+        /**
+         * Mutex
+         */
+        mutable std::mutex mutex_;
+
+        /**
+         * Pop
+         */
+        void pop();
+    };
+} // namespace engine
+
+#endif  // ENGINE_RELIABLE_BUFFER_HPP
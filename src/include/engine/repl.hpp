@@ -6,6 +6,7 @@
 #ifndef ENGINE_REPL_HPP
 #define ENGINE_REPL_HPP
 
+#include <functional>
 #include <memory>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/posix/stream_descriptor.hpp>
@@ -25,8 +26,9 @@ namespace engine {
          * Constructor
          *
          * @param state
+         * @param on_drain
          */
-        explicit repl(const std::shared_ptr<state> &state);
+        explicit repl(const std::shared_ptr<state> &state, std::function<void()> on_drain = {});
 
     private:
         /**
@@ -68,6 +70,11 @@ namespace engine {
          * State
          */
         std::shared_ptr<state> state_;
+
+        /**
+         * On Drain
+         */
+        std::function<void()> on_drain_;
     };
 } // namespace engine
 
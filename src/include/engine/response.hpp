@@ -11,6 +11,7 @@
 #include <boost/uuid/uuid.hpp>
 #include <map>
 #include <memory>
+#include <string>
 
 namespace engine {
     /**
@@ -32,11 +33,28 @@ namespace engine {
          */
         std::atomic<bool> is_ack_ = false;
 
+        /**
+         * Is Deferred
+         */
+        std::atomic<bool> is_deferred_ = false;
+
+        /**
+         * Is Offloaded
+         */
+        std::atomic<bool> is_offloaded_ = false;
+
         /**
          * Data
          */
         boost::json::object data_;
 
+        /**
+         * Message
+         *
+         * Pre-serialized reply, takes precedence over data.
+         */
+        std::shared_ptr<std::string const> message_;
+
     public:
         /**
          * Get Failed
@@ -59,6 +77,20 @@ namespace engine {
          */
         bool is_ack() const;
 
+        /**
+         * Is Deferred
+         *
+         * @return bool True when the handler suspended and the reply arrives through the kernel completion
+         */
+        bool is_deferred() const;
+
+        /**
+         * Is Offloaded
+         *
+         * @return bool True when the request runs on the worker pool
+         */
+        bool is_offloaded() const;
+
         /**
          * Get Data
          *
@@ -77,6 +109,20 @@ namespace engine {
         void mark_as_failed(boost::uuids::uuid transaction_id, const char *error, long timestamp,
                             const std::map<std::string, std::string> &bag);
 
+        /**
+         * Mark As Rejected
+         *
+         * @param message Pre-serialized reply
+         */
+        void mark_as_rejected(const std::shared_ptr<std::string const> &message);
+
+        /**
+         * Get Message
+         *
+         * @return shared_ptr<string const> Pre-serialized reply or the serialized data
+         */
+        std::shared_ptr<std::string const> get_message() const;
+
         /**
          * Mark As Processed
          */
@@ -87,6 +133,18 @@ namespace engine {
          */
         void mark_as_ack();
 
+        /**
+         * Mark As Deferred
+         */
+        void mark_as_deferred();
+
+        /**
+         * Mark As Offloaded
+         *
+         * Offloaded responses are deferred too.
+         */
+        void mark_as_offloaded();
+
         /**
          * Set Data
          *
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_RESPONSE_SEQUENCER_HPP
+#define ENGINE_RESPONSE_SEQUENCER_HPP
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace engine {
+    /**
+     * Response Sequencer
+     *
+     * Keeps the replies of a connection in the order of its requests. Every request reserves a slot before it
+     * reaches the kernel, a reply completed ahead of a suspended handler waits until the earlier slots are
+     * filled. Not thread safe, used from the strand of the connection.
+     */
+    class response_sequencer {
+    public:
+        /**
+         * Reserve
+         *
+         * @return uint64_t Slot of the next request
+         */
+        std::uint64_t reserve();
+
+        /**
+         * Complete
+         *
+         * @param slot
+         * @param message Reply of the slot, null when the request has no reply
+         * @return vector<shared_ptr<string const>> Replies ready to be sent, in request order
+         */
+        std::vector<std::shared_ptr<std::string const> > complete(std::uint64_t slot,
+                                                                  std::shared_ptr<std::string const> message);
+
+        /**
+         * Get Pending
+         *
+         * @return size_t Reserved slots whose reply wasn't sent yet
+         */
+        std::size_t get_pending() const;
+
+    private:
+        /**
+         * Slots
+         */
+        std::deque<std::optional<std::shared_ptr<std::string const> > > slots_;
+
+        /**
+         * Front
+         *
+         * Absolute number of the first slot in the deque.
+         */
+        std::uint64_t front_ = 0;
+    };
+} // namespace engine
+
+#endif  // ENGINE_RESPONSE_SEQUENCER_HPP
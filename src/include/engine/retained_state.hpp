@@ -0,0 +1,46 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_RETAINED_STATE_HPP
+#define ENGINE_RETAINED_STATE_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/uuid/uuid.hpp>
+
+namespace engine {
+    /**
+     * Retained State
+     *
+     * Clients and subscriptions of a peer kept after its session was lost, waiting for it to register again.
+     */
+    struct retained_state {
+        /**
+         * Clients
+         */
+        std::vector<boost::uuids::uuid> clients_;
+
+        /**
+         * Subscriptions
+         */
+        std::vector<std::pair<boost::uuids::uuid, std::string> > subscriptions_;
+
+        /**
+         * Version
+         */
+        std::int64_t version_ = -1;
+
+        /**
+         * Retained At
+         */
+        std::chrono::steady_clock::time_point retained_at_;
+    };
+} // namespace engine
+
+#endif  // ENGINE_RETAINED_STATE_HPP
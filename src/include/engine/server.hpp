@@ -9,10 +9,13 @@
 #include <engine/config.hpp>
 
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
 
+#include <boost/program_options/options_description.hpp>
 #include <boost/program_options/variables_map.hpp>
 
 #include "repl.hpp"
@@ -33,6 +36,11 @@ namespace engine {
      */
     class client_listener;
 
+    /**
+     * Forward Local Client Listener
+     */
+    class local_client_listener;
+
     class server : public std::enable_shared_from_this<server> {
         /**
          * State
@@ -49,6 +57,11 @@ namespace engine {
          */
         std::shared_ptr<client_listener> client_listener_;
 
+        /**
+         * Local Client Listener
+         */
+        std::shared_ptr<local_client_listener> local_client_listener_;
+
         /**
          * Vector Of Threads
          */
@@ -58,6 +71,26 @@ namespace engine {
          * REPL
          */
         std::unique_ptr<repl> repl_;
+
+        /**
+         * Drain Timer
+         */
+        std::unique_ptr<boost::asio::steady_timer> drain_timer_;
+
+        /**
+         * Drain Deadline
+         */
+        std::chrono::steady_clock::time_point drain_deadline_;
+
+        /**
+         * Drain Once
+         */
+        std::once_flag drain_once_;
+
+        /**
+         * Sessions Closing
+         */
+        bool sessions_closing_ = false;
     public:
         /**
          * Constructor
@@ -70,6 +103,8 @@ namespace engine {
 
         void start_client_listener();
 
+        void start_local_client_listener();
+
         /**
          * Start
          */
@@ -96,11 +131,28 @@ namespace engine {
          */
         void configure(const boost::program_options::variables_map &vm) const;
 
+        /**
+         * Get Options
+         *
+         * Command line options read by configure.
+         *
+         * @return options_description
+         */
+        static boost::program_options::options_description get_options();
+
         /**
          * Stop
          */
         void stop() const;
 
+        /**
+         * Drain
+         *
+         * Stops accepting connections, hints clients where to reconnect and stops once they left or the deadline
+         * expired, saying goodbye to the sessions before.
+         */
+        void drain();
+
     private:
         /**
          * Resolve
@@ -111,6 +163,18 @@ namespace engine {
          */
         boost::asio::ip::basic_resolver_results<boost::asio::ip::tcp> resolve(const std::string &host, unsigned short port) const;
 
+        /**
+         * Do Drain
+         */
+        void do_drain();
+
+        /**
+         * On Drain Timer
+         *
+         * @param ec
+         */
+        void on_drain_timer(const boost::system::error_code &ec);
+
         /**
          * Connect To Remote
          */
@@ -7,9 +7,20 @@
 #define ENGINE_SESSION_HPP
 
 #include <engine/session_context.hpp>
+#include <engine/load.hpp>
+#include <engine/outbound_queue.hpp>
+#include <engine/response_sequencer.hpp>
+#include <engine/tls_stream.hpp>
 
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/json/object.hpp>
 #include <boost/uuid/uuid.hpp>
 
@@ -53,6 +64,57 @@ namespace engine {
          */
         session_context context_;
 
+        /**
+         * Node ID
+         */
+        boost::uuids::uuid node_id_{};
+
+        /**
+         * Node ID Mutex
+         *
+         * Written on the primary strand, read from the lanes and the snapshot thread.
+         */
+        mutable std::mutex node_id_mutex_;
+
+        /**
+         * Lane
+         */
+        unsigned short lane_ = 0;
+
+        /**
+         * Peer Version
+         *
+         * Version of the remote State on the last reconciliation, -1 when unknown.
+         */
+        std::atomic<std::int64_t> peer_version_ = -1;
+
+        /**
+         * Primary
+         */
+        std::weak_ptr<session> primary_;
+
+        /**
+         * Lanes
+         */
+        std::vector<std::shared_ptr<session> > lanes_;
+
+        /**
+         * Lanes Shared Mutex
+         */
+        mutable std::shared_mutex lanes_mutex_;
+
+        /**
+         * Load
+         *
+         * Last load reported by the remote State.
+         */
+        std::optional<load> load_;
+
+        /**
+         * Load Mutex
+         */
+        mutable std::mutex load_mutex_;
+
     public:
         /**
          * Constructor
@@ -81,14 +143,26 @@ namespace engine {
          *
          * @return tcp::socket
          */
-        boost::beast::websocket::stream<boost::asio::ssl::stream<boost::beast::tcp_stream>> &get_socket();
+        boost::beast::websocket::stream<tls_stream> &get_socket();
+
+        /**
+         * Send
+         *
+         * @param data
+         * @param priority
+         */
+        void send(std::shared_ptr<std::string const> const &data, priority priority = control);
 
         /**
          * Send
          *
+         * Routes the message to the lane owning the key, messages with the same key keep their order. Keyed
+         * messages are fan out payloads and travel as bulk.
+         *
          * @param data
+         * @param key
          */
-        void send(std::shared_ptr<std::string const> const &data);
+        void send(std::shared_ptr<std::string const> const &data, std::string_view key);
 
         /**
          * Run
@@ -148,6 +222,105 @@ namespace engine {
          * @return
          */
         bool get_registered() const;
+
+        /**
+         * Get Node ID
+         *
+         * @return uuid
+         */
+        boost::uuids::uuid get_node_id() const;
+
+        /**
+         * Set Node ID
+         *
+         * @param node_id
+         */
+        void set_node_id(boost::uuids::uuid node_id);
+
+        /**
+         * Get Peer Version
+         *
+         * @return int64_t
+         */
+        std::int64_t get_peer_version() const;
+
+        /**
+         * Set Peer Version
+         *
+         * @param version
+         */
+        void set_peer_version(std::int64_t version);
+
+        /**
+         * Get RTT
+         *
+         * @return int64_t Smoothed round trip time in microseconds or -1 when unknown
+         */
+        std::int64_t get_rtt() const;
+
+        /**
+         * Get Jitter
+         *
+         * @return int64_t Round trip time variation in microseconds
+         */
+        std::int64_t get_jitter() const;
+
+        /**
+         * Is Healthy
+         *
+         * @return bool
+         */
+        bool is_healthy() const;
+
+        /**
+         * Get Load
+         *
+         * @return optional<load>
+         */
+        std::optional<load> get_load() const;
+
+        /**
+         * Set Load
+         *
+         * @param load
+         */
+        void set_load(const load &load);
+
+        /**
+         * Get Lane
+         *
+         * @return unsigned short
+         */
+        unsigned short get_lane() const;
+
+        /**
+         * Get Lanes Count
+         *
+         * @return size_t
+         */
+        std::size_t get_lanes_count() const;
+
+        /**
+         * Attach Lane
+         *
+         * @param lane
+         * @param number
+         */
+        void attach_lane(const std::shared_ptr<session> &lane, unsigned short number);
+
+        /**
+         * Detach Lane
+         *
+         * @param lane
+         */
+        void detach_lane(const std::shared_ptr<session> &lane);
+
+        /**
+         * Close
+         *
+         * Says goodbye to the peer with the websocket closing handshake, lanes included.
+         */
+        void close();
     private:
         /**
          * State
@@ -159,10 +332,22 @@ namespace engine {
          */
         boost::uuids::uuid id_;
 
+        /**
+         * Peer ID
+         *
+         * Identifier used against the state, lanes act on behalf of their primary session.
+         */
+        boost::uuids::uuid peer_id_;
+
+        /**
+         * Register Transaction ID
+         */
+        std::string register_transaction_id_;
+
         /**
          * Socket
          */
-        boost::beast::websocket::stream<boost::asio::ssl::stream<boost::beast::tcp_stream>> socket_;
+        boost::beast::websocket::stream<tls_stream> socket_;
 
         /**
          * Buffer
@@ -172,7 +357,76 @@ namespace engine {
         /**
          * Queue
          */
-        std::vector<std::shared_ptr<std::string const> > queue_;
+        outbound_queue queue_;
+
+        /**
+         * Replies
+         *
+         * Keeps the replies in request order while a handler is suspended.
+         */
+        response_sequencer replies_;
+
+        /**
+         * Batch
+         */
+        std::vector<std::shared_ptr<std::string const> > batch_;
+
+        /**
+         * Batch Bytes
+         */
+        std::size_t batch_bytes_ = 0;
+
+        /**
+         * Batch Timer
+         */
+        boost::asio::steady_timer batch_timer_;
+
+        /**
+         * Batch Scheduled
+         */
+        bool batch_scheduled_ = false;
+
+        /**
+         * Heartbeat Timer
+         */
+        boost::asio::steady_timer heartbeat_timer_;
+
+        /**
+         * Heartbeat Sequence
+         */
+        std::uint64_t heartbeat_sequence_ = 0;
+
+        /**
+         * Heartbeat Sent At
+         */
+        std::chrono::steady_clock::time_point heartbeat_sent_at_;
+
+        /**
+         * Heartbeat Pending
+         *
+         * A ping is in flight and waits for its pong.
+         */
+        bool heartbeat_pending_ = false;
+
+        /**
+         * Last Seen At
+         */
+        std::chrono::steady_clock::time_point last_seen_at_;
+
+        /**
+         * RTT
+         */
+        std::atomic<std::int64_t> rtt_ = -1;
+
+        /**
+         * Jitter
+         */
+        std::atomic<std::int64_t> jitter_ = 0;
+
+        /**
+         * Healthy
+         */
+        std::atomic<bool> healthy_ = true;
 
         /**
          * TLS Shutdown Started
@@ -205,6 +459,35 @@ namespace engine {
          */
         void on_server_handshake(const boost::beast::error_code &ec);
 
+        /**
+         * Enable Kernel TX
+         *
+         * @param type
+         */
+        void enable_kernel_tx(boost::asio::ssl::stream_base::handshake_type type);
+
+        /**
+         * Open Lanes
+         */
+        void open_lanes();
+
+        /**
+         * On Lane Connect
+         *
+         * @param ec
+         */
+        void on_lane_connect(const boost::system::error_code &ec);
+
+        /**
+         * Close Lanes
+         */
+        void close_lanes();
+
+        /**
+         * Remove From State
+         */
+        void remove_from_state();
+
         /**
          * Do Read
          */
@@ -218,12 +501,92 @@ namespace engine {
          */
         void on_read(const boost::system::error_code &ec, std::size_t bytes_transferred);
 
+        /**
+         * On Message
+         *
+         * @param data
+         */
+        void on_message(const boost::json::object &data);
+
+        /**
+         * On Reply
+         *
+         * @param slot
+         * @param message
+         */
+        void on_reply(std::uint64_t slot, std::shared_ptr<std::string const> message);
+
+        /**
+         * On Register Ack
+         *
+         * @param data
+         */
+        void on_register_ack(const boost::json::object &data);
+
         /**
          * On Send
          *
          * @param data
+         * @param priority
          */
-        void on_send(std::shared_ptr<std::string const> const &data);
+        void on_send(std::shared_ptr<std::string const> const &data, priority priority);
+
+        /**
+         * Do Write
+         *
+         * @param data
+         * @param priority
+         */
+        void do_write(std::shared_ptr<std::string const> const &data, priority priority);
+
+        /**
+         * Write Next
+         */
+        void write_next();
+
+        /**
+         * Flush Batch
+         */
+        void flush_batch();
+
+        /**
+         * On Batch Timer
+         *
+         * @param ec
+         */
+        void on_batch_timer(const boost::system::error_code &ec);
+
+        /**
+         * Start Heartbeat
+         */
+        void start_heartbeat();
+
+        /**
+         * On Heartbeat Timer
+         *
+         * @param ec
+         */
+        void on_heartbeat_timer(const boost::system::error_code &ec);
+
+        /**
+         * On Ping
+         *
+         * @param ec
+         */
+        void on_ping(const boost::system::error_code &ec);
+
+        /**
+         * On Control
+         *
+         * @param kind
+         * @param payload
+         */
+        void on_control(boost::beast::websocket::frame_type kind, boost::beast::string_view payload);
+
+        /**
+         * Mark As Dead
+         */
+        void mark_as_dead();
 
         /**
          * On Write
@@ -238,6 +601,13 @@ namespace engine {
          */
         void do_tls_shutdown();
 
+        /**
+         * On Close
+         *
+         * @param ec
+         */
+        void on_close(const boost::system::error_code &ec);
+
         /**
          * On TLS Shutdown
          *
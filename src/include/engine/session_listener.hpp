@@ -64,6 +64,13 @@ namespace engine {
          * Start
          */
         void start();
+
+        /**
+         * Stop
+         *
+         * Closes the acceptor, established sessions stay untouched.
+         */
+        void stop();
     };
 } // namespace engine
 
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_SNAPSHOT_HPP
+#define ENGINE_SNAPSHOT_HPP
+
+#include <engine/retained_state.hpp>
+
+#include <boost/uuid/uuid.hpp>
+
+#include <filesystem>
+#include <map>
+
+namespace engine {
+    /**
+     * Snapshot
+     *
+     * Clients, subscriptions and version of every peer by node id.
+     */
+    using snapshot = std::map<boost::uuids::uuid, retained_state>;
+
+    /**
+     * Write Snapshot
+     *
+     * Serializes the peers in a compact binary layout into a temporary file and renames it over the path, a
+     * crash never leaves a partial snapshot behind.
+     *
+     * @param path
+     * @param peers
+     * @return bool
+     */
+    bool write_snapshot(const std::filesystem::path &path, const snapshot &peers);
+
+    /**
+     * Read Snapshot
+     *
+     * Maps the file and bulk loads the peers.
+     *
+     * @param path
+     * @return snapshot Empty when the file is missing, truncated or corrupted
+     */
+    snapshot read_snapshot(const std::filesystem::path &path);
+} // namespace engine
+
+#endif  // ENGINE_SNAPSHOT_HPP
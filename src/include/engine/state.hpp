@@ -9,16 +9,39 @@
 #include <engine/config.hpp>
 #include <engine/subscriptions.hpp>
 #include <engine/clients.hpp>
+#include <engine/digest.hpp>
+#include <engine/retained_state.hpp>
+#include <engine/load.hpp>
+#include <engine/dedup_window.hpp>
+#include <engine/channel_history.hpp>
+#include <engine/last_value_cache.hpp>
+#include <engine/token_bucket.hpp>
+#include <engine/priority.hpp>
+#include <engine/queue_latency.hpp>
+#include <engine/worker_pool.hpp>
+#include <engine/publish_log.hpp>
+#include <engine/reliable_buffer.hpp>
+#include <engine/string_hash.hpp>
 
 #include <boost/uuid/uuid.hpp>
+#include <boost/uuid/uuid_hash.hpp>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <map>
 #include <memory>
 #include <vector>
+#include <mutex>
+#include <set>
+#include <optional>
 #include <shared_mutex>
+#include <unordered_map>
+#include <string_view>
 
+#include <boost/json/array.hpp>
 #include <boost/json/object.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/ssl/context.hpp>
 
 namespace engine {
@@ -41,6 +64,23 @@ namespace engine {
          */
         boost::asio::io_context ioc_;
 
+        /**
+         * Handshake IO Context
+         */
+        boost::asio::io_context handshake_ioc_;
+
+        /**
+         * Workers
+         */
+        worker_pool workers_;
+
+        /**
+         * Log IO Context
+         *
+         * Runs the group commits of the publish logs and the snapshots away from the connections.
+         */
+        boost::asio::io_context log_ioc_;
+
         /**
          * Session Listener SSL Context
          */
@@ -138,6 +178,14 @@ namespace engine {
         std::optional<std::shared_ptr<client> > get_client(
             boost::uuids::uuid id) const;
 
+        /**
+         * Get Route
+         *
+         * @param client_id
+         * @return shared_ptr<session>
+         */
+        std::shared_ptr<session> get_route(boost::uuids::uuid client_id) const;
+
         /**
          * Add Session
          *
@@ -170,6 +218,37 @@ namespace engine {
          */
         bool remove_client(boost::uuids::uuid client_id);
 
+        /**
+         * Enable Reliable
+         *
+         * @param client_id
+         * @return shared_ptr<reliable_buffer> Retransmit buffer of the client, created on first use
+         */
+        std::shared_ptr<reliable_buffer> enable_reliable(boost::uuids::uuid client_id);
+
+        /**
+         * Resume Reliable
+         *
+         * Moves the retransmit buffer of a disconnected client to the new connection of the same client.
+         *
+         * @param client_id
+         * @param previous_id Client ID of the lost connection
+         * @param token Secret issued when the lost connection enabled the reliable mode
+         * @param sequence Last sequence received by the client
+         * @return shared_ptr<reliable_buffer> Null when there is nothing to resume, the token doesn't match or the client has a buffer
+         */
+        std::shared_ptr<reliable_buffer> resume_reliable(boost::uuids::uuid client_id, boost::uuids::uuid previous_id,
+                                                         std::string_view token,
+                                                         std::uint64_t sequence);
+
+        /**
+         * Get Reliable Buffer
+         *
+         * @param client_id
+         * @return shared_ptr<reliable_buffer> Null when the client isn't in reliable mode
+         */
+        std::shared_ptr<reliable_buffer> get_reliable_buffer(boost::uuids::uuid client_id) const;
+
         /**
          * Subscribe
          *
@@ -192,6 +271,27 @@ namespace engine {
         bool unsubscribe(const boost::uuids::uuid &session_id, const boost::uuids::uuid &client_id,
                          const std::string &channel);
 
+        /**
+         * Subscribe
+         *
+         * Inserts all the subscriptions under a single lock, walking the index in key order with hinted
+         * insertions.
+         *
+         * @param subscriptions
+         * @return vector<bool>
+         */
+        std::vector<bool> subscribe(const std::vector<subscription> &subscriptions);
+
+        /**
+         * Unsubscribe
+         *
+         * Removes all the subscriptions under a single lock.
+         *
+         * @param subscriptions
+         * @return vector<bool>
+         */
+        std::vector<bool> unsubscribe(const std::vector<subscription> &subscriptions);
+
         /**
          * Is Subscribed
          *
@@ -254,6 +354,8 @@ namespace engine {
         /**
          * Publish To Clients
          *
+         * Records the envelope in the channel history when enabled.
+         *
          * @param request
          * @param session_id
          * @param client_id
@@ -264,7 +366,60 @@ namespace engine {
          */
         std::size_t publish_to_clients(const request &request, boost::uuids::uuid session_id,
                                        boost::uuids::uuid client_id, const std::string &channel,
-                                       const boost::json::object &data) const;
+                                       const boost::json::object &data);
+
+        /**
+         * Allow Publish
+         *
+         * Draws from the bucket of the channel shared by all local clients. Buckets already refilled are removed
+         * once the map doubles, a full bucket and a missing one behave the same.
+         *
+         * @param channel
+         * @param now Steady clock nanoseconds
+         * @return bool
+         */
+        bool allow_publish(std::string_view channel, std::int64_t now);
+
+        /**
+         * Get Channel Limits Size
+         *
+         * @return size_t
+         */
+        std::size_t get_channel_limits_size() const;
+
+        /**
+         * Is Conflated Channel
+         *
+         * @param channel
+         * @return bool True when the channel is conflated for every client
+         */
+        bool is_conflated_channel(std::string_view channel) const;
+
+        /**
+         * Send Last Value
+         *
+         * Sends the most recent envelope published on the channel to the client with the priority of the replies.
+         *
+         * @param client_id
+         * @param channel
+         * @return bool
+         */
+        bool send_last_value(boost::uuids::uuid client_id, const std::string &channel) const;
+
+        /**
+         * Replay
+         *
+         * Sends the envelopes kept in the channel history after the given sequence or timestamp to the client with the
+         * priority of the replies, so they reach it before the subscription reply.
+         *
+         * @param client_id
+         * @param channel
+         * @param sequence
+         * @param timestamp
+         * @return size_t
+         */
+        std::size_t replay(boost::uuids::uuid client_id, const std::string &channel,
+                           std::optional<std::uint64_t> sequence, std::optional<std::int64_t> timestamp);
 
 
         /**
@@ -297,6 +452,18 @@ namespace engine {
         std::size_t subscribe_to_sessions(const request &request,
                                           boost::uuids::uuid client_id, const std::string &channel) const;
 
+        /**
+         * Subscribe To Sessions
+         *
+         * @param request
+         * @param client_id
+         * @param channels
+         *
+         * @return size_t
+         */
+        std::size_t subscribe_to_sessions(const request &request,
+                                          boost::uuids::uuid client_id, const std::vector<std::string> &channels) const;
+
         /**
          *  Push Client
          *
@@ -313,6 +480,94 @@ namespace engine {
          */
         void sync(const std::shared_ptr<session> &session, bool registered);
 
+        /**
+         * Get Version
+         *
+         * @return int64_t
+         */
+        std::int64_t get_version() const;
+
+        /**
+         * Get Digest
+         *
+         * Digest of the clients and subscriptions this State advertises to the session.
+         *
+         * @param session_id
+         * @return digest
+         */
+        digest get_digest(boost::uuids::uuid session_id) const;
+
+        /**
+         * Get View
+         *
+         * Digest of the clients and subscriptions this State believes the session owns.
+         *
+         * @param session_id
+         * @return digest
+         */
+        digest get_view(boost::uuids::uuid session_id) const;
+
+        /**
+         * Reconcile
+         *
+         * @param session
+         * @param remote
+         * @param version
+         * @return size_t Buckets requested to the session
+         */
+        std::size_t reconcile(const std::shared_ptr<session> &session, const digest &remote, std::int64_t version);
+
+        /**
+         * Send Buckets
+         *
+         * @param session
+         * @param buckets
+         * @return size_t
+         */
+        std::size_t send_buckets(const std::shared_ptr<session> &session,
+                                 const std::vector<std::size_t> &buckets) const;
+
+        /**
+         * Retain State Of Session
+         *
+         * @param id
+         * @param node_id
+         * @param version
+         */
+        void retain_state_of_session(boost::uuids::uuid id, boost::uuids::uuid node_id, std::int64_t version);
+
+        /**
+         * Adopt State Of Session
+         *
+         * @param id
+         * @param node_id
+         * @return int64_t Version of the retained state or -1
+         */
+        std::int64_t adopt_state_of_session(boost::uuids::uuid id, boost::uuids::uuid node_id);
+
+        /**
+         * Load Snapshot
+         *
+         * Retains the peers found in the snapshot as if their sessions were just lost.
+         *
+         * @return size_t Peers loaded
+         */
+        std::size_t load_snapshot();
+
+        /**
+         * Save Snapshot
+         *
+         * Writes the clients, subscriptions and version of the registered and retained peers.
+         *
+         * @return bool
+         */
+        bool save_snapshot() const;
+
+        /**
+         * Start Snapshots
+         */
+        void start_snapshots();
+
         /**
          * Get IO Context
          *
@@ -320,6 +575,27 @@ namespace engine {
          */
         boost::asio::io_context &get_ioc();
 
+        /**
+         * Get Handshake IO Context
+         *
+         * @return
+         */
+        boost::asio::io_context &get_handshake_ioc();
+
+        /**
+         * Get Workers
+         *
+         * @return worker_pool
+         */
+        worker_pool &get_workers();
+
+        /**
+         * Get Log IO Context
+         *
+         * @return
+         */
+        boost::asio::io_context &get_log_ioc();
+
         /**
          * Unsubscribe To Sessions
          *
@@ -331,6 +607,29 @@ namespace engine {
         std::size_t unsubscribe_to_sessions(const request &request,
                                             boost::uuids::uuid client_id, const std::string &channel) const;
 
+        /**
+         * Unsubscribe To Sessions
+         *
+         * @param request
+         * @param client_id
+         * @param channels
+         * @return size_t
+         */
+        std::size_t unsubscribe_to_sessions(const request &request,
+                                            boost::uuids::uuid client_id,
+                                            const std::vector<std::string> &channels) const;
+
+        /**
+         * Batch To Sessions
+         *
+         * Propagates the subscription changes of a batch as a single message.
+         *
+         * @param request
+         * @param requests
+         * @return size_t
+         */
+        std::size_t batch_to_sessions(const request &request, const boost::json::array &requests) const;
+
         /**
          * Remove State Of Session
          *
@@ -349,6 +648,162 @@ namespace engine {
         void send_to_session(boost::uuids::uuid session_id, boost::uuids::uuid from_client_id,
                              boost::uuids::uuid to_client_id, const boost::json::object &payload) const;
 
+        /**
+         * Is Relay
+         *
+         * @return bool
+         */
+        bool is_relay() const;
+
+        /**
+         * Is Loop
+         *
+         * @param data
+         * @return bool
+         */
+        bool is_loop(const boost::json::object &data) const;
+
+        /**
+         * Relay
+         *
+         * Forwards a request received from a session to every other session.
+         *
+         * @param request
+         * @param key
+         * @return size_t
+         */
+        std::size_t relay(const request &request, std::string_view key = {}) const;
+
+        /**
+         * Relay To Subscribed
+         *
+         * @param request
+         * @param channel
+         * @return size_t
+         */
+        std::size_t relay_to_subscribed(const request &request, const std::string &channel) const;
+
+        /**
+         * Relay To Session
+         *
+         * @param request
+         * @param session_id
+         * @param key
+         * @return bool
+         */
+        bool relay_to_session(const request &request, boost::uuids::uuid session_id, std::string_view key) const;
+
+        /**
+         * Is Duplicate
+         *
+         * Remembers publish, broadcast and send envelopes received from peers by transaction and client id.
+         *
+         * @param data
+         * @return bool True when the envelope was already received inside the dedup window
+         */
+        bool is_duplicate(const boost::json::object &data);
+
+        /**
+         * Get Dedup Hits
+         *
+         * @return uint64_t
+         */
+        std::uint64_t get_dedup_hits() const;
+
+        /**
+         * Get Dedup Misses
+         *
+         * @return uint64_t
+         */
+        std::uint64_t get_dedup_misses() const;
+
+        /**
+         * Count Message
+         */
+        void count_message();
+
+        /**
+         * Add Queued
+         *
+         * @param count Negative when messages leave the queue
+         */
+        void add_queued(std::int64_t count);
+
+        /**
+         * Record Queue Latency
+         *
+         * @param priority
+         * @param wait Time the message waited on an outbound queue
+         */
+        void record_queue_latency(priority priority, std::chrono::steady_clock::duration wait);
+
+        /**
+         * Get Queue Latency
+         *
+         * @param priority
+         * @return queue_latency
+         */
+        queue_latency get_queue_latency(priority priority) const;
+
+        /**
+         * Get Load
+         *
+         * @return load
+         */
+        load get_load() const;
+
+        /**
+         * Start Load Reports
+         */
+        void start_load_reports();
+
+        /**
+         * Start Log Sync
+         *
+         * Flushes the publish logs every interval under the interval fsync policy.
+         */
+        void start_log_sync();
+
+        /**
+         * Sync Publish Logs
+         */
+        void sync_publish_logs() const;
+
+        /**
+         * Get Redirect
+         *
+         * Least loaded peer to receive new clients, nullptr while this State is under the threshold.
+         *
+         * @return shared<session>
+         */
+        std::shared_ptr<session> get_redirect() const;
+
+        /**
+         * Get Peers By Load
+         *
+         * Healthy peers able to receive clients, least loaded first.
+         *
+         * @return vector<shared<session>>
+         */
+        std::vector<std::shared_ptr<session> > get_peers_by_load() const;
+
+        /**
+         * Is Draining
+         *
+         * @return bool
+         */
+        bool is_draining() const;
+
+        /**
+         * Drain
+         *
+         * Sends every local client a hint with the peer to reconnect to and a delay spread over the window.
+         *
+         * @param window
+         * @return size_t Clients notified
+         */
+        std::size_t drain(std::chrono::milliseconds window);
+
         /**
          * Get Config
          *
@@ -384,7 +839,51 @@ namespace engine {
          */
         boost::asio::ssl::context & get_client_ssl_context();
 
+        /**
+         * Prepare SSL Contexts
+         *
+         * Installs the kernel TLS hooks on every context when enabled, must run before the first handshake.
+         */
+        void prepare_ssl_contexts();
+
     private:
+        /**
+         * Get Dedup
+         *
+         * @return dedup_window
+         */
+        dedup_window &get_dedup() const;
+
+        /**
+         * On Load Timer
+         *
+         * @param ec
+         */
+        void on_load_timer(const boost::system::error_code &ec);
+
+        /**
+         * On Log Timer
+         *
+         * @param ec
+         */
+        void on_log_timer(const boost::system::error_code &ec);
+
+        /**
+         * On Snapshot Timer
+         *
+         * @param ec
+         */
+        void on_snapshot_timer(const boost::system::error_code &ec);
+
+        /**
+         * Evict Reliable Buffers
+         *
+         * Drops the expired orphan buffers and the oldest ones above the orphans limit, the caller holds the lock.
+         *
+         * @param now
+         */
+        void evict_reliable_buffers(std::chrono::steady_clock::time_point now);
+
         /**
          * Send To Sessions
          *
@@ -393,6 +892,15 @@ namespace engine {
          */
         std::size_t send_to_sessions(const boost::json::object &data) const;
 
+        /**
+         * Send To Sessions
+         *
+         * @param data
+         * @param key Llave usada para elegir el carril de cada sesión
+         * @return
+         */
+        std::size_t send_to_sessions(const boost::json::object &data, std::string_view key) const;
+
         /**
          * Send To Clients
          *
@@ -405,6 +913,88 @@ namespace engine {
                                            boost::uuids::uuid session_id,
                                            boost::uuids::uuid client_id) const;
 
+        /**
+         * Send To Clients
+         *
+         * @param data Serialized message
+         * @param session_id Sesión que recibió la solicitud del Cliente
+         * @param client_id Cliente que solicitó transmitir
+         * @param channel Channel of a publish, allows conflation
+         * @return
+         */
+        std::size_t send_to_others_clients(const std::shared_ptr<std::string const> &data,
+                                           boost::uuids::uuid session_id,
+                                           boost::uuids::uuid client_id,
+                                           const std::shared_ptr<std::string const> &channel = nullptr) const;
+
+        /**
+         * Get History
+         *
+         * @param channel
+         * @param create
+         * @return channel_history
+         */
+        channel_history *get_history(const std::string &channel, bool create);
+
+        /**
+         * Get Log
+         *
+         * Without create only a log already present on disk is opened.
+         *
+         * @param channel
+         * @param create
+         * @return publish_log Null when disabled, missing or the channel name doesn't fit in a file name
+         */
+        publish_log *get_log(const std::string &channel, bool create);
+
+        /**
+         * Get Subscriptions Order
+         *
+         * @param subscriptions
+         * @return vector<size_t> Positions of the subscriptions sorted by session, client and channel
+         */
+        static std::vector<std::size_t> get_subscriptions_order(const std::vector<subscription> &subscriptions);
+
+        /**
+         * Is Advertised
+         *
+         * @param owner Session owning the client or subscription
+         * @param target Session receiving the advertisement
+         * @return bool
+         */
+        bool is_advertised(boost::uuids::uuid owner, boost::uuids::uuid target) const;
+
+        /**
+         * Drop Buckets
+         *
+         * @param session_id
+         * @param buckets
+         */
+        void drop_buckets(boost::uuids::uuid session_id, const std::vector<std::size_t> &buckets);
+
+        /**
+         * Make Session Message
+         *
+         * @param data
+         * @return shared_ptr<string const>
+         */
+        std::shared_ptr<std::string const> make_session_message(const boost::json::object &data) const;
+
+        /**
+         * Make Relay Message
+         *
+         * @param request
+         * @return shared_ptr<string const>
+         */
+        std::shared_ptr<std::string const> make_relay_message(const request &request) const;
+
+        /**
+         * Add Route
+         *
+         * @param client
+         */
+        void add_route(const std::shared_ptr<client> &client);
+
         /**
          * ID
          */
@@ -435,6 +1025,177 @@ namespace engine {
          */
         mutable std::shared_mutex clients_mutex_;
 
+        /**
+         * Version
+         */
+        std::atomic<std::int64_t> version_{0};
+
+        /**
+         * Retained
+         */
+        std::map<boost::uuids::uuid, retained_state> retained_;
+
+        /**
+         * Retained Mutex
+         */
+        mutable std::mutex retained_mutex_;
+
+        /**
+         * Messages
+         */
+        std::atomic<std::uint64_t> messages_{0};
+
+        /**
+         * Queued
+         */
+        std::atomic<std::int64_t> queued_{0};
+
+        /**
+         * Rate
+         */
+        std::atomic<double> rate_{0};
+
+        /**
+         * Queue Latency Count
+         */
+        std::array<std::atomic<std::uint64_t>, 2> queue_latency_count_{};
+
+        /**
+         * Queue Latency Total
+         */
+        std::array<std::atomic<std::uint64_t>, 2> queue_latency_total_{};
+
+        /**
+         * Queue Latency Max
+         */
+        std::array<std::atomic<std::uint64_t>, 2> queue_latency_max_{};
+
+        /**
+         * Reported Messages
+         */
+        std::uint64_t reported_messages_ = 0;
+
+        /**
+         * Reported At
+         */
+        std::chrono::steady_clock::time_point reported_at_;
+
+        /**
+         * Draining
+         */
+        std::atomic<bool> draining_{false};
+
+        /**
+         * Dedup
+         */
+        mutable std::unique_ptr<dedup_window> dedup_;
+
+        /**
+         * Dedup Once
+         */
+        mutable std::once_flag dedup_once_;
+
+        /**
+         * Conflated Channels
+         */
+        mutable std::set<std::string, std::less<> > conflated_channels_;
+
+        /**
+         * Conflated Channels Once
+         */
+        mutable std::once_flag conflated_channels_once_;
+
+        /**
+         * SSL Contexts Once
+         */
+        std::once_flag ssl_contexts_once_;
+
+        /**
+         * Channel Limits
+         *
+         * Arrival time of the next publish per channel.
+         */
+        std::unordered_map<std::string, std::unique_ptr<std::atomic<std::int64_t> >, string_hash, std::equal_to<> >
+        channel_limits_;
+
+        /**
+         * Channel Limits Sweep At
+         *
+         * Size of the channel limits that triggers the next removal of idle buckets.
+         */
+        std::size_t channel_limits_sweep_at_ = 1024;
+
+        /**
+         * Channel Limits Shared Mutex
+         */
+        mutable std::shared_mutex channel_limits_mutex_;
+
+        /**
+         * Last Values
+         */
+        last_value_cache last_values_;
+
+        /**
+         * Histories
+         */
+        std::unordered_map<std::string, std::unique_ptr<channel_history> > histories_;
+
+        /**
+         * Histories Shared Mutex
+         */
+        mutable std::shared_mutex histories_mutex_;
+
+        /**
+         * Publish Logs
+         */
+        std::unordered_map<std::string, std::unique_ptr<publish_log> > publish_logs_;
+
+        /**
+         * Publish Logs Shared Mutex
+         *
+         * Taken after the histories mutex when both are needed.
+         */
+        mutable std::shared_mutex publish_logs_mutex_;
+
+        /**
+         * Reliable Buffers
+         *
+         * Retransmit buffers by client, kept after a disconnection until resumed or expired.
+         */
+        std::unordered_map<boost::uuids::uuid, std::shared_ptr<reliable_buffer> > reliable_buffers_;
+
+        /**
+         * Reliable Buffers Mutex
+         */
+        mutable std::mutex reliable_buffers_mutex_;
+
+        /**
+         * Load Timer
+         */
+        boost::asio::steady_timer load_timer_;
+
+        /**
+         * Log Timer
+         */
+        boost::asio::steady_timer log_timer_;
+
+        /**
+         * Snapshot Timer
+         */
+        boost::asio::steady_timer snapshot_timer_;
+
+        /**
+         * Routes
+         *
+         * Cliente remoto hacia la sesión que lo posee
+         */
+        std::unordered_map<boost::uuids::uuid, std::weak_ptr<session> > routes_;
+
+        /**
+         * Routes Shared Mutex
+         */
+        mutable std::shared_mutex routes_mutex_;
+
         /**
          * Subscriptions
          */
@@ -0,0 +1,37 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_STRING_HASH_HPP
+#define ENGINE_STRING_HASH_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace engine {
+    /**
+     * String Hash
+     *
+     * Transparent hash, lets string keyed maps be searched by string_view without allocating.
+     */
+    struct string_hash {
+        /**
+         * Is Transparent
+         */
+        using is_transparent = void;
+
+        /**
+         * Call
+         *
+         * @param value
+         * @return size_t
+         */
+        std::size_t operator()(const std::string_view value) const {
+            return std::hash<std::string_view>{}(value);
+        }
+    };
+} // namespace engine
+
+#endif  // ENGINE_STRING_HASH_HPP
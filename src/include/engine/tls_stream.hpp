@@ -0,0 +1,217 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_TLS_STREAM_HPP
+#define ENGINE_TLS_STREAM_HPP
+
+#include <utility>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/ssl/context.hpp>
+#include <boost/asio/ssl/stream.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/core/role.hpp>
+#include <boost/beast/websocket/teardown.hpp>
+
+namespace engine {
+    /**
+     * TLS Stream
+     *
+     * Wraps ssl::stream<tcp_stream>. Once kernel TLS transmission is enabled the
+     * records are encrypted by the kernel and writes go straight to the socket,
+     * reads keep going through OpenSSL. Anything OpenSSL would write afterwards
+     * closes the connection.
+     */
+    class tls_stream {
+    public:
+        /**
+         * Next Layer Type
+         */
+        using next_layer_type = boost::asio::ssl::stream<boost::beast::tcp_stream>;
+
+        /**
+         * Executor Type
+         */
+        using executor_type = next_layer_type::executor_type;
+
+        /**
+         * Constructor
+         *
+         * @param arg
+         * @param context
+         */
+        template<class Arg>
+        tls_stream(Arg &&arg, boost::asio::ssl::context &context) : stream_(std::forward<Arg>(arg), context) {
+        }
+
+        /**
+         * Constructor
+         *
+         * Adopts an SSL handle whose handshake already completed on another stream.
+         *
+         * @param arg
+         * @param handle
+         * @param kernel_tx
+         */
+        template<class Arg>
+        tls_stream(Arg &&arg, SSL *handle, const bool kernel_tx) : stream_(std::forward<Arg>(arg), handle),
+                                                                   kernel_tx_(kernel_tx) {
+        }
+
+        /**
+         * Get Executor
+         *
+         * @return executor_type
+         */
+        executor_type get_executor() noexcept { return stream_.get_executor(); }
+
+        /**
+         * Next Layer
+         *
+         * @return next_layer_type
+         */
+        next_layer_type &next_layer() { return stream_; }
+
+        /**
+         * Lowest Layer
+         *
+         * @return tcp::socket
+         */
+        decltype(auto) lowest_layer() { return stream_.lowest_layer(); }
+
+        /**
+         * Native Handle
+         *
+         * @return SSL
+         */
+        SSL *native_handle() { return stream_.native_handle(); }
+
+        /**
+         * Get Kernel TX
+         *
+         * @return bool
+         */
+        bool get_kernel_tx() const { return kernel_tx_; }
+
+        /**
+         * Enable Kernel TX
+         *
+         * Must be called right after the TLS handshake and before any application data was written.
+         *
+         * @param type
+         * @return bool
+         */
+        bool enable_kernel_tx(boost::asio::ssl::stream_base::handshake_type type);
+
+        /**
+         * Prepare Context
+         *
+         * @param context
+         * @param listener
+         */
+        static void prepare_context(boost::asio::ssl::context &context, bool listener);
+
+        /**
+         * Async Handshake
+         *
+         * @param type
+         * @param handler
+         */
+        template<class HandshakeHandler>
+        void async_handshake(const boost::asio::ssl::stream_base::handshake_type type, HandshakeHandler &&handler) {
+            stream_.async_handshake(type, std::forward<HandshakeHandler>(handler));
+        }
+
+        /**
+         * Async Shutdown
+         *
+         * close_notify can't be produced by OpenSSL once the kernel owns the write sequence.
+         *
+         * @param handler
+         */
+        template<class ShutdownHandler>
+        void async_shutdown(ShutdownHandler &&handler) {
+            if (kernel_tx_) {
+                boost::asio::post(stream_.get_executor(),
+                                  [_handler = std::forward<ShutdownHandler>(handler)]() mutable {
+                                      _handler(boost::system::error_code{});
+                                  });
+                return;
+            }
+            stream_.async_shutdown(std::forward<ShutdownHandler>(handler));
+        }
+
+        /**
+         * Async Read Some
+         *
+         * @param buffers
+         * @param handler
+         */
+        template<class MutableBufferSequence, class ReadHandler>
+        void async_read_some(const MutableBufferSequence &buffers, ReadHandler &&handler) {
+            stream_.async_read_some(buffers, std::forward<ReadHandler>(handler));
+        }
+
+        /**
+         * Async Write Some
+         *
+         * @param buffers
+         * @param handler
+         */
+        template<class ConstBufferSequence, class WriteHandler>
+        void async_write_some(const ConstBufferSequence &buffers, WriteHandler &&handler) {
+            if (kernel_tx_) {
+                stream_.next_layer().async_write_some(buffers, std::forward<WriteHandler>(handler));
+                return;
+            }
+            stream_.async_write_some(buffers, std::forward<WriteHandler>(handler));
+        }
+
+    private:
+        /**
+         * Stream
+         */
+        next_layer_type stream_;
+
+        /**
+         * Kernel TX
+         */
+        bool kernel_tx_ = false;
+    };
+
+    /**
+     * Teardown
+     *
+     * @param role
+     * @param stream
+     * @param ec
+     */
+    inline void teardown(const boost::beast::role_type role, tls_stream &stream, boost::system::error_code &ec) {
+        if (stream.get_kernel_tx()) {
+            boost::beast::websocket::teardown(role, stream.next_layer().next_layer().socket(), ec);
+            return;
+        }
+        stream.next_layer().shutdown(ec);
+    }
+
+    /**
+     * Async Teardown
+     *
+     * @param role
+     * @param stream
+     * @param handler
+     */
+    template<class TeardownHandler>
+    void async_teardown(const boost::beast::role_type role, tls_stream &stream, TeardownHandler &&handler) {
+        if (stream.get_kernel_tx()) {
+            boost::beast::websocket::async_teardown(role, stream.next_layer().next_layer().socket(),
+                                                    std::forward<TeardownHandler>(handler));
+            return;
+        }
+        stream.next_layer().async_shutdown(std::forward<TeardownHandler>(handler));
+    }
+} // namespace engine
+
+#endif  // ENGINE_TLS_STREAM_HPP
@@ -0,0 +1,80 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_TOKEN_BUCKET_HPP
+#define ENGINE_TOKEN_BUCKET_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace engine {
+    /**
+     * Token Bucket
+     *
+     * Kept as the theoretical arrival time of the next message (GCRA), so a check is a comparison and an
+     * addition over a single integer. Times are steady clock nanoseconds.
+     */
+    class token_bucket {
+    public:
+        /**
+         * Constructor
+         */
+        token_bucket() = default;
+
+        /**
+         * Constructor
+         *
+         * @param rate Messages per second (0: unlimited)
+         * @param burst Messages accepted at once
+         */
+        token_bucket(std::size_t rate, std::size_t burst);
+
+        /**
+         * Is Enabled
+         *
+         * @return bool
+         */
+        bool is_enabled() const;
+
+        /**
+         * Consume
+         *
+         * Not thread safe, used from the strand owning the bucket.
+         *
+         * @param now
+         * @return bool False when the message must be rejected
+         */
+        bool consume(std::int64_t now);
+
+        /**
+         * Consume
+         *
+         * Thread safe variant over a shared arrival time.
+         *
+         * @param tat
+         * @param now
+         * @return bool False when the message must be rejected
+         */
+        bool consume(std::atomic<std::int64_t> &tat, std::int64_t now) const;
+
+    private:
+        /**
+         * Interval
+         */
+        std::int64_t interval_ = 0;
+
+        /**
+         * Tolerance
+         */
+        std::int64_t tolerance_ = 0;
+
+        /**
+         * TAT
+         */
+        std::int64_t tat_ = 0;
+    };
+} // namespace engine
+
+#endif  // ENGINE_TOKEN_BUCKET_HPP
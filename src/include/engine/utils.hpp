@@ -6,11 +6,17 @@
 #ifndef ENGINE_UTILS_HPP
 #define ENGINE_UTILS_HPP
 
+#include <boost/json/array.hpp>
 #include <boost/json/object.hpp>
 #include <boost/uuid/uuid.hpp>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
+#include <engine/fsync_policy.hpp>
 #include <engine/kernel_context.hpp>
+#include <engine/subscription.hpp>
 
 namespace engine {
     /**
@@ -117,6 +123,27 @@ namespace engine {
      */
     bool get_param_as_bool(const boost::json::object &params, const char *field);
 
+    /**
+     * Get Param As Strings
+     *
+     * @param params
+     * @param field
+     * @return vector<string>
+     */
+    std::vector<std::string> get_param_as_strings(const boost::json::object &params, const char *field);
+
+    /**
+     * Make Subscriptions
+     *
+     * @param session_id
+     * @param client_id
+     * @param channels
+     * @return vector<subscription>
+     */
+    std::vector<subscription> make_subscriptions(const boost::uuids::uuid &session_id,
+                                                 const boost::uuids::uuid &client_id,
+                                                 const std::vector<std::string> &channels);
+
     /**
      * Make Broadcast Request Object
      *
@@ -183,6 +210,47 @@ namespace engine {
                                                         const boost::uuids::uuid &client_id,
                                                         const std::string &channel);
 
+    /**
+     * Make Subscribe Request Object
+     *
+     * @param request
+     * @param client_id
+     * @param channels
+     * @return object
+     */
+    boost::json::object make_subscribe_request_object(const request &request,
+                                                      const boost::uuids::uuid &client_id,
+                                                      const std::vector<std::string> &channels);
+
+    /**
+     * Make Unsubscribe Request Object
+     *
+     * @param request
+     * @param client_id
+     * @param channels
+     * @return object
+     */
+    boost::json::object make_unsubscribe_request_object(const request &request,
+                                                        const boost::uuids::uuid &client_id,
+                                                        const std::vector<std::string> &channels);
+
+    /**
+     * Make Batch Request Object
+     *
+     * @param request
+     * @param requests
+     * @return object
+     */
+    boost::json::object make_batch_request_object(const request &request, const boost::json::array &requests);
+
+    /**
+     * Make Redirect Object
+     *
+     * @param session
+     * @return object
+     */
+    boost::json::object make_redirect_object(const std::shared_ptr<session> &session);
+
     /**
      * Get Status
      *
@@ -200,6 +268,14 @@ namespace engine {
      * @return string
      */
     std::string kernel_context_to_string(kernel_context context);
+
+    /**
+     * String To Fsync Policy
+     *
+     * @param value
+     * @return fsync_policy Interval when the value is unknown
+     */
+    fsync_policy string_to_fsync_policy(std::string_view value);
 }
 
 #endif // ENGINE_UTILS_HPP
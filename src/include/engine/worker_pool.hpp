@@ -0,0 +1,99 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#pragma once
+
+#ifndef ENGINE_WORKER_POOL_HPP
+#define ENGINE_WORKER_POOL_HPP
+
+#include <engine/latency_meter.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include <boost/asio/io_context.hpp>
+
+namespace engine {
+    /**
+     * Worker Pool
+     *
+     * Bounded queue of heavy tasks run by the worker threads of the server. Tasks beyond the capacity are refused
+     * so the caller can push back, the time tasks wait and run is measured.
+     */
+    class worker_pool {
+    public:
+        /**
+         * Submit
+         *
+         * @param task
+         * @param capacity Tasks allowed to wait or run at once
+         * @return bool False when the pool is full and the task was dropped
+         */
+        bool submit(std::function<void()> task, std::size_t capacity);
+
+        /**
+         * Get IO Context
+         *
+         * @return io_context
+         */
+        boost::asio::io_context &get_ioc();
+
+        /**
+         * Get Pending
+         *
+         * @return size_t Tasks waiting or running
+         */
+        std::size_t get_pending() const;
+
+        /**
+         * Get Rejected
+         *
+         * @return uint64_t
+         */
+        std::uint64_t get_rejected() const;
+
+        /**
+         * Get Queue Time
+         *
+         * @return queue_latency
+         */
+        queue_latency get_queue_time() const;
+
+        /**
+         * Get Run Time
+         *
+         * @return queue_latency
+         */
+        queue_latency get_run_time() const;
+
+    private:
+        /**
+         * IO Context
+         */
+        boost::asio::io_context ioc_;
+
+        /**
+         * Pending
+         */
+        std::atomic<std::size_t> pending_ = 0;
+
+        /**
+         * Rejected
+         */
+        std::atomic<std::uint64_t> rejected_ = 0;
+
+        /**
+         * Queue Time
+         */
+        latency_meter queue_time_;
+
+        /**
+         * Run Time
+         */
+        latency_meter run_time_;
+    };
+} // namespace engine
+
+#endif  // ENGINE_WORKER_POOL_HPP
@@ -0,0 +1,30 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/async_request.hpp>
+
+namespace engine {
+    async_request async_request::make(const request &request) {
+        return async_request{
+            .transaction_id_ = request.transaction_id_,
+            .response_ = request.response_,
+            .entity_id_ = request.entity_id_,
+            .context_ = request.context_,
+            .state_ = request.state_,
+            .data_ = request.data_,
+            .timestamp_ = request.timestamp_,
+        };
+    }
+
+    request async_request::to_request() {
+        return request{
+            .transaction_id_ = transaction_id_,
+            .response_ = response_,
+            .entity_id_ = entity_id_,
+            .context_ = context_,
+            .state_ = state_,
+            .data_ = data_,
+            .timestamp_ = timestamp_,
+        };
+    }
+} // namespace engine
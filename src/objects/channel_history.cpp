@@ -0,0 +1,150 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/channel_history.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace engine {
+    channel_history::channel_history(const std::size_t messages, const std::size_t bytes,
+                                     const std::int64_t age) : buffer_(bytes), entries_(std::max<std::size_t>(messages, 1)),
+                                                               age_(age) {
+    }
+
+    std::uint64_t channel_history::get_next_sequence() const {
+        return next_sequence_;
+    }
+
+    void channel_history::resume(const std::uint64_t next_sequence) {
+        if (count_ == 0 && next_sequence > next_sequence_)
+            next_sequence_ = next_sequence;
+    }
+
+    bool channel_history::append(const std::int64_t timestamp, const std::string_view data) {
+        const auto _sequence = next_sequence_++;
+
+        evict_expired(timestamp);
+
+        if (data.size() > buffer_.size())
+            return false;
+
+        if (count_ == entries_.size())
+            pop();
+
+        // Se busca un tramo contiguo libre, si no existe se desalojan los más antiguos.
+        std::size_t _offset = 0;
+        for (;;) {
+            if (count_ == 0) {
+                head_ = 0;
+                _offset = 0;
+                break;
+            }
+
+            if (const auto _tail = get_entry(0).offset_; _tail < head_) {
+                if (data.size() <= buffer_.size() - head_) {
+                    _offset = head_;
+                    break;
+                }
+                if (data.size() <= _tail) {
+                    _offset = 0;
+                    break;
+                }
+            } else if (data.size() <= _tail - head_) {
+                _offset = head_;
+                break;
+            }
+
+            pop();
+        }
+
+        std::memcpy(buffer_.data() + _offset, data.data(), data.size());
+
+        entries_[(first_ + count_) % entries_.size()] = entry{
+            .sequence_ = _sequence,
+            .timestamp_ = timestamp,
+            .offset_ = _offset,
+            .size_ = data.size(),
+        };
+
+        ++count_;
+        head_ = _offset + data.size();
+        bytes_ += data.size();
+        return true;
+    }
+
+    std::vector<std::shared_ptr<std::string const> > channel_history::get_since_sequence(
+        const std::uint64_t sequence, const std::int64_t now) const {
+        std::size_t _low = 0;
+        std::size_t _high = count_;
+        while (_low < _high) {
+            if (const auto _middle = _low + (_high - _low) / 2; get_entry(_middle).sequence_ <= sequence)
+                _low = _middle + 1;
+            else
+                _high = _middle;
+        }
+
+        return copy_from(_low, now);
+    }
+
+    std::vector<std::shared_ptr<std::string const> > channel_history::get_since_timestamp(
+        const std::int64_t timestamp, const std::int64_t now) const {
+        std::size_t _low = 0;
+        std::size_t _high = count_;
+        while (_low < _high) {
+            if (const auto _middle = _low + (_high - _low) / 2; get_entry(_middle).timestamp_ < timestamp)
+                _low = _middle + 1;
+            else
+                _high = _middle;
+        }
+
+        return copy_from(_low, now);
+    }
+
+    std::size_t channel_history::get_size() const {
+        return count_;
+    }
+
+    std::size_t channel_history::get_bytes() const {
+        return bytes_;
+    }
+
+    std::mutex &channel_history::get_mutex() {
+        return mutex_;
+    }
+
+    void channel_history::evict_expired(const std::int64_t now) {
+        if (age_ == 0)
+            return;
+
+        while (count_ > 0 && now - get_entry(0).timestamp_ > age_)
+            pop();
+    }
+
+    void channel_history::pop() {
+        bytes_ -= entries_[first_].size_;
+        first_ = (first_ + 1) % entries_.size();
+        --count_;
+    }
+
+    const channel_history::entry &channel_history::get_entry(const std::size_t index) const {
+        return entries_[(first_ + index) % entries_.size()];
+    }
+
+    std::vector<std::shared_ptr<std::string const> > channel_history::copy_from(
+        std::size_t index, const std::int64_t now) const {
+        // Los expirados todavía no desalojados no se reenvían.
+        while (age_ != 0 && index < count_ && now - get_entry(index).timestamp_ > age_)
+            ++index;
+
+        std::vector<std::shared_ptr<std::string const> > _messages;
+        _messages.reserve(count_ - index);
+
+        for (; index < count_; ++index) {
+            const auto &_entry = get_entry(index);
+            _messages.emplace_back(std::make_shared<std::string const>(buffer_.data() + _entry.offset_, _entry.size_));
+        }
+
+        return _messages;
+    }
+} // namespace engine
@@ -7,8 +7,11 @@
 #include <engine/state.hpp>
 #include <engine/kernel.hpp>
 #include <engine/response.hpp>
+#include <engine/utils.hpp>
 #include <boost/asio/ssl.hpp>
 #include <boost/beast/websocket/ssl.hpp>
+#include <boost/beast/http/read.hpp>
+#include <boost/asio/strand.hpp>
 
 #include <boost/core/ignore_unused.hpp>
 
@@ -17,12 +20,16 @@
 #include <boost/json/parse.hpp>
 #include <boost/json/serialize.hpp>
 
+#include <unistd.h>
+
 namespace engine {
     client::client(const boost::uuids::uuid session_id,
                    const std::shared_ptr<state> &state, const boost::uuids::uuid id) : state_(state),
         id_(id),
         session_id_(session_id),
-        is_local_(state->get_id() == session_id) {
+        is_local_(state->get_id() == session_id),
+        limiter_(*state->get_config()),
+        queue_(state->get_config()->queue_control_weight_) {
         LOG_INFO("state_id=[{}] action=[client_allocated] session_id=[{}] client_id=[{}]", to_string(state_->get_id()),
                  to_string(session_id), to_string(id_));
     }
@@ -30,6 +37,8 @@ namespace engine {
     client::~client() {
         LOG_INFO("state_id=[{}] action=[client_released] session_id=[{}] client_id=[{}]", to_string(state_->get_id()),
                  to_string(get_session_id()), to_string(id_));
+
+        state_->add_queued(-static_cast<std::int64_t>(queue_.size()));
     }
 
     boost::uuids::uuid client::get_id() const { return id_; }
@@ -43,9 +52,14 @@ namespace engine {
     }
 
     void client::run() {
+        if (local_socket_.has_value()) {
+            do_accept();
+            return;
+        }
+
         if (socket_.has_value()) {
             auto &_socket = socket_.value();
-            get_lowest_layer(_socket).expires_after(std::chrono::seconds(30));
+            boost::beast::get_lowest_layer(_socket).expires_after(std::chrono::seconds(30));
 
             _socket.next_layer().async_handshake(
                     boost::asio::ssl::stream_base::server,
@@ -55,31 +69,92 @@ namespace engine {
         }
     }
 
-    void client::send(std::shared_ptr<std::string const> const &data) {
+    void client::send(std::shared_ptr<std::string const> const &data, const priority priority) {
         boost::ignore_unused(data);
 
+        if (local_socket_.has_value()) {
+            if (auto &_socket = local_socket_.value(); _socket.is_open()) {
+                post(_socket.get_executor(),
+                     boost::beast::bind_front_handler(&client::on_send, shared_from_this(), data, priority));
+            }
+            return;
+        }
+
+        if (socket_.has_value()) {
+            if (auto &_socket = socket_.value(); _socket.is_open()) {
+                post(_socket.next_layer().get_executor(),
+                     boost::beast::bind_front_handler(&client::on_send, shared_from_this(), data, priority));
+            }
+        }
+    }
+
+    void client::publish(std::shared_ptr<std::string const> const &data,
+                         std::shared_ptr<std::string const> const &channel) {
+        if (local_socket_.has_value()) {
+            if (auto &_socket = local_socket_.value(); _socket.is_open()) {
+                post(_socket.get_executor(),
+                     boost::beast::bind_front_handler(&client::on_publish, shared_from_this(), data, channel));
+            }
+            return;
+        }
+
         if (socket_.has_value()) {
             if (auto &_socket = socket_.value(); _socket.is_open()) {
                 post(_socket.next_layer().get_executor(),
-                     boost::beast::bind_front_handler(&client::on_send, shared_from_this(), data));
+                     boost::beast::bind_front_handler(&client::on_publish, shared_from_this(), data, channel));
             }
         }
     }
 
+    void client::set_conflated(const std::string &channel, const bool conflated) {
+        if (local_socket_.has_value()) {
+            post(local_socket_->get_executor(),
+                 boost::beast::bind_front_handler(&client::on_set_conflated, shared_from_this(), channel, conflated));
+            return;
+        }
+
+        if (socket_.has_value()) {
+            post(socket_->next_layer().get_executor(),
+                 boost::beast::bind_front_handler(&client::on_set_conflated, shared_from_this(), channel, conflated));
+        }
+    }
+
+    void client::set_reliable(std::shared_ptr<reliable_buffer> buffer, const bool redeliver) {
+        if (local_socket_.has_value()) {
+            post(local_socket_->get_executor(),
+                 boost::beast::bind_front_handler(&client::on_set_reliable, shared_from_this(), std::move(buffer),
+                                                  redeliver));
+            return;
+        }
+
+        if (socket_.has_value()) {
+            post(socket_->next_layer().get_executor(),
+                 boost::beast::bind_front_handler(&client::on_set_reliable, shared_from_this(), std::move(buffer),
+                                                  redeliver));
+        }
+    }
+
     void client::set_socket(boost::asio::ip::tcp::socket &&socket) {
         socket_.emplace(std::move(socket), state_->get_client_listener_ssl_context());
     }
 
+    void client::set_local_socket(boost::asio::local::stream_protocol::socket &&socket) {
+        local_socket_.emplace(std::move(socket));
+    }
+
     void client::on_accept(long run_at, const boost::beast::error_code &ec) {
-        if (ec) {
-            state_->remove_client(id_);
-            const auto _ = state_->leave_to_sessions(get_id());
-            boost::ignore_unused(_);
+        if (ec)
             return;
-        }
+
+        upgrade_request_ = {};
+
+        // Recién aquí el socket es definitivo y corre en su strand, antes nadie más puede alcanzar al cliente.
+        state_->add_client(shared_from_this());
+        const auto _ = state_->join_to_sessions(get_id());
+        boost::ignore_unused(_);
 
         auto _now = std::chrono::system_clock::now().time_since_epoch().count();
-        const boost::json::object _welcome = {
+        boost::json::object _welcome = {
             {"transaction_id", to_string(boost::uuids::random_generator()())},
             {"action", "welcome"},
             {"status", "success"},
@@ -88,12 +163,22 @@ namespace engine {
             {"runtime", _now - run_at},
             {"data", {{"client_id", to_string(get_id())}}},
         };
-        send(std::make_shared<std::string const>(serialize(_welcome)));
+
+        // Sobre el umbral de carga el cliente recibe la instancia menos cargada a la cual reconectarse.
+        if (const auto _redirect = state_->get_redirect())
+            _welcome.at("data").as_object()["redirect"] = make_redirect_object(_redirect);
+
+        send(std::make_shared<std::string const>(serialize(_welcome)), control);
 
         do_read();
     }
 
     void client::do_read() {
+        if (local_socket_.has_value()) {
+            local_socket_->async_read(buffer_, boost::beast::bind_front_handler(&client::on_read, shared_from_this()));
+            return;
+        }
+
         auto &_socket = socket_.value();
         _socket.async_read(buffer_, boost::beast::bind_front_handler(&client::on_read, shared_from_this()));
     }
@@ -124,9 +209,26 @@ namespace engine {
 
         boost::system::error_code _parse_ec;
 
+        state_->count_message();
+
         if (auto _data = boost::json::parse(_stream, _parse_ec); !_parse_ec && _data.is_object()) {
-            const auto _response = kernel(state_, _data.as_object(), on_client, get_id());
-            send(std::make_shared<std::string const>(serialize(_response->get_data())));
+            const auto _slot = replies_.reserve();
+            const auto _response = kernel(state_, _data.as_object(), on_client, get_id(), &limiter_, get_executor(),
+                                          [_self = shared_from_this(), _slot](const std::shared_ptr<response> &response) {
+                                              _self->on_reply(_slot, response->get_message());
+
+                                              if (response->is_offloaded())
+                                                  _self->do_read();
+                                          });
+
+            if (!_response->is_deferred())
+                on_reply(_slot, _response->get_message());
+
+            // Mientras una acción pesada corre en el pool no se lee, así sus cambios no se adelantan a los siguientes.
+            if (_response->is_offloaded()) {
+                buffer_.consume(buffer_.size());
+                return;
+            }
         } else {
             auto _now = std::chrono::system_clock::now().time_since_epoch().count();
             const boost::json::object _response = {
@@ -141,7 +243,7 @@ namespace engine {
                 {"timestamp", _now},
                 {"runtime", _now - _read_at},
             };
-            send(std::make_shared<std::string const>(serialize(_response)));
+            on_reply(replies_.reserve(), std::make_shared<std::string const>(serialize(_response)));
         }
 
         buffer_.consume(buffer_.size());
@@ -149,70 +251,261 @@ namespace engine {
         do_read();
     }
 
-    void client::on_send(std::shared_ptr<std::string const> const &data) {
-        queue_.push_back(data);
+    void client::drain(std::shared_ptr<std::string const> const &hint) {
+        // Aviso y bandera van juntos en el strand, así on_write no cierra antes de tener el aviso en la cola.
+        post(get_executor(), [self = shared_from_this(), hint] {
+            self->enqueue(hint, control, {});
+            self->draining_.store(true, std::memory_order_release);
+        });
+    }
+
+    void client::on_send(std::shared_ptr<std::string const> const &data, const priority priority) {
+        // Las respuestas y avisos de control no se numeran, solo las entregas.
+        if (reliable_ && priority == bulk) {
+            enqueue(reliable_->push(data), bulk, {});
+            return;
+        }
+
+        enqueue(data, priority, {});
+    }
+
+    void client::on_reply(const std::uint64_t slot, std::shared_ptr<std::string const> message) {
+        for (const auto &_message: replies_.complete(slot, std::move(message)))
+            send(_message, control);
+    }
+
+    boost::asio::any_io_executor client::get_executor() {
+        if (local_socket_.has_value())
+            return local_socket_->get_executor();
+
+        return socket_->next_layer().get_executor();
+    }
+
+    void client::on_publish(std::shared_ptr<std::string const> const &data,
+                            std::shared_ptr<std::string const> const &channel) {
+        // En modo confiable nada se reemplaza, cada publicación se numera y espera su confirmación.
+        if (reliable_) {
+            enqueue(reliable_->push(data), bulk, {});
+            return;
+        }
+
+        if (!conflated_.contains(*channel) && !state_->is_conflated_channel(*channel)) {
+            enqueue(data, bulk, {});
+            return;
+        }
+
+        // Un mensaje del canal aún sin entregar se reemplaza por el más reciente en su misma posición.
+        if (!closing_ && queue_.replace(*channel, data))
+            return;
+
+        enqueue(data, bulk, *channel);
+    }
+
+    void client::on_set_conflated(const std::string &channel, const bool conflated) {
+        if (conflated)
+            conflated_.insert(channel);
+        else
+            conflated_.erase(channel);
+    }
+
+    void client::on_set_reliable(const std::shared_ptr<reliable_buffer> &buffer, const bool redeliver) {
+        reliable_ = buffer;
+
+        if (!redeliver)
+            return;
+
+        for (const auto &_message: buffer->get_unconfirmed())
+            enqueue(_message, bulk, {});
+    }
 
-        if (queue_.size() > 1)
+    void client::enqueue(std::shared_ptr<std::string const> const &data, const priority priority,
+                         const std::string_view key) {
+        // El cierre ya fue iniciado, websocket no admite más escrituras.
+        if (closing_)
             return;
 
-        const auto _message = *queue_.begin();
+        state_->add_queued(1);
+
+        if (!queue_.push(data, priority, std::chrono::steady_clock::now(), key))
+            return;
 
         LOG_INFO("state_id=[{}] action=[write] session_id=[{}] client_id=[{}] data=[{}]", to_string(state_->get_id()),
-                         to_string(get_session_id()), to_string(id_), *_message);
+                         to_string(get_session_id()), to_string(id_), *data);
+
+        do_write();
+    }
+
+    void client::on_write(const boost::beast::error_code &ec, std::size_t bytes_transferred) {
+        if (ec)
+            return;
+
+        queue_.complete();
+        state_->add_queued(-1);
+
+        if (!queue_.empty())
+            do_write();
+        else if (draining_.load(std::memory_order_acquire))
+            do_close();
+    }
+
+    void client::do_close() {
+        closing_ = true;
+
+        const boost::beast::websocket::close_reason _reason{boost::beast::websocket::close_code::going_away};
+
+        if (local_socket_.has_value()) {
+            local_socket_->async_close(_reason, boost::beast::bind_front_handler(&client::on_close, shared_from_this()));
+            return;
+        }
+
+        if (socket_.has_value())
+            socket_->async_close(_reason, boost::beast::bind_front_handler(&client::on_close, shared_from_this()));
+    }
+
+    void client::on_close(const boost::beast::error_code &ec) {
+        // La lectura pendiente recibe el cierre y libera al cliente del estado.
+        if (ec) {
+            LOG_INFO("state_id=[{}] action=[close] client_id=[{}] ec=[{}]", to_string(state_->get_id()),
+                     to_string(id_), ec.message());
+        }
+    }
+
+    void client::do_write() {
+        const auto _item = queue_.next();
+        if (_item == nullptr)
+            return;
+
+        state_->record_queue_latency(_item->priority_, std::chrono::steady_clock::now() - _item->queued_at_);
+
+        if (local_socket_.has_value()) {
+            if (auto &_socket = local_socket_.value(); _socket.is_open()) {
+                _socket.async_write(boost::asio::buffer(*_item->data_),
+                                    boost::beast::bind_front_handler(&client::on_write, shared_from_this()));
+            }
+            return;
+        }
 
         if (socket_.has_value()) {
             if (auto &_socket = socket_.value(); _socket.is_open()) {
-                _socket.async_write(boost::asio::buffer(*queue_.front()),
+                _socket.async_write(boost::asio::buffer(*_item->data_),
                                     boost::beast::bind_front_handler(&client::on_write, shared_from_this()));
             }
         }
     }
 
-    void client::on_write(const boost::beast::error_code &ec, std::size_t bytes_transferred) {
+    void client::on_handshake(const boost::beast::error_code &ec) {
         if (ec)
             return;
 
-        queue_.erase(queue_.begin());
+        auto &_socket = socket_.value();
 
-        if (!queue_.empty() && socket_.has_value()) {
-            if (auto &_socket = socket_.value(); _socket.is_open()) {
-                _socket.async_write(
-                    boost::asio::buffer(*queue_.front()),
-                    boost::beast::bind_front_handler(
-                        &client::on_write,
-                        shared_from_this()));
-            }
+        if (state_->get_config()->ssl_ktls_enabled_) {
+            const auto _kernel_tx = _socket.next_layer().enable_kernel_tx(boost::asio::ssl::stream_base::server);
+            LOG_INFO("state_id=[{}] action=[ktls] client_id=[{}] kernel_tx=[{}]", to_string(state_->get_id()),
+                     to_string(id_), _kernel_tx);
         }
+
+        // Con el pool de handshakes también se lee el upgrade HTTP aquí, así el cliente queda esperando la
+        // respuesta y no hay bytes en tránsito cuando el socket cambia de contexto.
+        if (state_->get_config()->handshake_threads_ > 0) {
+            boost::beast::http::async_read(_socket.next_layer(), buffer_, upgrade_request_,
+                                           boost::beast::bind_front_handler(
+                                               &client::on_upgrade_request, shared_from_this()));
+            return;
+        }
+
+        do_accept();
     }
 
-    void client::on_handshake(const boost::beast::error_code &ec) {
+    void client::on_upgrade_request(const boost::beast::error_code &ec, std::size_t bytes_transferred) {
+        boost::ignore_unused(bytes_transferred);
+
         if (ec) {
-            state_->remove_client(id_);
-            const auto _ = state_->leave_to_sessions(id_);
-            boost::ignore_unused(_);
+            do_tls_shutdown();
+            return;
+        }
+
+        buffer_.consume(buffer_.size());
+
+        auto &_stream = socket_->next_layer();
+        auto &_lowest = boost::beast::get_lowest_layer(socket_.value()).socket();
+        const auto _kernel_tx = _stream.get_kernel_tx();
+
+        boost::system::error_code _ec;
+        const auto _protocol = _lowest.local_endpoint(_ec).protocol();
+
+        SSL *_handle = _stream.native_handle();
+        SSL_up_ref(_handle);
+
+        const auto _descriptor = _ec ? -1 : _lowest.release(_ec);
+
+        boost::asio::ip::tcp::socket _socket{make_strand(state_->get_ioc())};
+        if (!_ec)
+            _socket.assign(_protocol, _descriptor, _ec);
+
+        if (_ec) {
+            LOG_INFO("state_id=[{}] action=[handover_failed] client_id=[{}] ec=[{}]", to_string(state_->get_id()),
+                     to_string(id_), _ec.message());
+
+            if (_descriptor >= 0 && !_socket.is_open())
+                ::close(_descriptor);
+
+            SSL_free(_handle);
+            return;
+        }
+
+        // El SSL ya negociado pasa al nuevo stream, el anterior sólo libera su referencia.
+        socket_.emplace(std::move(_socket), _handle, _kernel_tx);
+
+        dispatch(socket_->get_executor(), boost::beast::bind_front_handler(&client::do_accept, shared_from_this()));
+    }
+
+    void client::do_accept() {
+        if (local_socket_.has_value()) {
+            auto &_socket = local_socket_.value();
+            _socket.set_option(
+                        boost::beast::websocket::stream_base::timeout::suggested(boost::beast::role_type::server));
+
+            auto _run_at = std::chrono::system_clock::now().time_since_epoch().count();
+            _socket.async_accept(boost::beast::bind_front_handler(&client::on_accept, shared_from_this(), _run_at));
             return;
         }
 
         auto &_socket = socket_.value();
-        get_lowest_layer(_socket).expires_never();
+        boost::beast::get_lowest_layer(_socket).expires_never();
 
         _socket.set_option(
                     boost::beast::websocket::stream_base::timeout::suggested(boost::beast::role_type::server));
 
         auto _run_at = std::chrono::system_clock::now().time_since_epoch().count();
+
+        if (state_->get_config()->handshake_threads_ > 0) {
+            _socket.async_accept(upgrade_request_,
+                                 boost::beast::bind_front_handler(&client::on_accept, shared_from_this(), _run_at));
+            return;
+        }
+
         _socket.async_accept(boost::beast::bind_front_handler(&client::on_accept, shared_from_this(), _run_at));
     }
 
     void client::do_tls_shutdown() {
-        if (!socket_.has_value())
+        if (bool _expected = false; !tls_shutdown_started_.compare_exchange_strong(_expected, true))
             return;
 
-        if (bool _expected = false; !tls_shutdown_started_.compare_exchange_strong(_expected, true))
+        // Los clientes locales no tienen TLS, basta con cerrar el socket.
+        if (local_socket_.has_value()) {
+            boost::system::error_code _ec;
+            local_socket_->next_layer().shutdown(boost::asio::local::stream_protocol::socket::shutdown_both, _ec);
+            local_socket_->next_layer().close(_ec);
+            return;
+        }
+
+        if (!socket_.has_value())
             return;
 
         auto& ws = socket_.value();
 
-        if (!get_lowest_layer(ws).socket().is_open())
+        if (!boost::beast::get_lowest_layer(ws).socket().is_open())
             return;
 
         ws.next_layer().async_shutdown(
@@ -232,11 +525,11 @@ namespace engine {
 
         boost::system::error_code _ec;
         auto& _ws = socket_.value();
-        get_lowest_layer(_ws).socket().shutdown(
+        boost::beast::get_lowest_layer(_ws).socket().shutdown(
             boost::asio::ip::tcp::socket::shutdown_both, _ec);
-        get_lowest_layer(_ws).socket().close(_ec);
+        boost::beast::get_lowest_layer(_ws).socket().close(_ec);
     }
 
 
-    std::optional<boost::beast::websocket::stream<boost::asio::ssl::stream<boost::beast::tcp_stream>>> &client::get_socket() { return socket_; }
+    std::optional<boost::beast::websocket::stream<tls_stream>> &client::get_socket() { return socket_; }
 } // namespace engine
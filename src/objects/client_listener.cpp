@@ -3,6 +3,7 @@
 
 #include <engine/client_listener.hpp>
 
+#include <boost/asio/post.hpp>
 #include <boost/asio/strand.hpp>
 
 #include <engine/logger.hpp>
@@ -49,18 +50,19 @@ namespace engine {
         } else {
             const auto _client = std::make_shared<client>(state_->get_id(), state_);
             _client->set_socket(std::move(socket));
-            state_->add_client(_client);
-            const auto _ = state_->join_to_sessions(_client->get_id());
-            boost::ignore_unused(_);
             _client->run();
         }
 
-        do_accept();
+        if (acceptor_.is_open())
+            do_accept();
     }
 
     void client_listener::do_accept() {
+        // Con un pool dedicado el handshake TLS y el upgrade ocurren fuera de los hilos que atienden mensajes.
+        auto &_ioc = state_->get_config()->handshake_threads_ > 0 ? state_->get_handshake_ioc() : ioc_;
+
         acceptor_.async_accept(
-            make_strand(ioc_),
+            make_strand(_ioc),
             boost::beast::bind_front_handler(
                 &client_listener::on_accept,
                 shared_from_this()));
@@ -69,4 +71,11 @@ namespace engine {
     void client_listener::start() {
         do_accept();
     }
+
+    void client_listener::stop() {
+        post(acceptor_.get_executor(), [_listener = shared_from_this()] {
+            boost::system::error_code _ec;
+            _listener->acceptor_.close(_ec);
+        });
+    }
 } // namespace engine
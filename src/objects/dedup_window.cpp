@@ -0,0 +1,162 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/dedup_window.hpp>
+
+#include <algorithm>
+#include <bit>
+
+namespace engine {
+    namespace {
+        /**
+         * Mix
+         *
+         * Finalizador de splitmix64, los identificadores de clientes no siempre son aleatorios.
+         *
+         * @param key
+         * @return uint64_t
+         */
+        std::uint64_t mix(const dedup_window::key &key) {
+            std::uint64_t _hash = key.high_ ^ (key.low_ * 0x9e3779b97f4a7c15ULL);
+            _hash = (_hash ^ (_hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            _hash = (_hash ^ (_hash >> 27)) * 0x94d049bb133111ebULL;
+            return _hash ^ (_hash >> 31);
+        }
+
+        /**
+         * From Hex
+         *
+         * @param character
+         * @return int -1 when the character is not hexadecimal
+         */
+        int from_hex(const char character) {
+            if (character >= '0' && character <= '9')
+                return character - '0';
+            if (character >= 'a' && character <= 'f')
+                return character - 'a' + 10;
+            if (character >= 'A' && character <= 'F')
+                return character - 'A' + 10;
+            return -1;
+        }
+    }
+
+    dedup_window::dedup_window(const std::size_t capacity, const std::chrono::steady_clock::duration ttl)
+        : ttl_(ttl) {
+        // La mitad de los espacios queda libre para que las secuencias de sondeo se mantengan cortas.
+        const auto _slots = std::bit_ceil(std::max<std::size_t>(capacity / shards * 2, 16));
+        mask_ = _slots - 1;
+
+        const auto _now = std::chrono::steady_clock::now();
+        for (auto &_shard: shards_) {
+            for (auto &_generation: _shard.generations_)
+                _generation.slots_.resize(_slots);
+            _shard.rotated_at_ = _now;
+            _shard.previous_at_ = _now;
+        }
+    }
+
+    std::optional<dedup_window::key> dedup_window::make_key(const std::string_view id) {
+        if (id.size() != 36)
+            return std::nullopt;
+
+        key _key;
+        std::size_t _digits = 0;
+
+        for (std::size_t _i = 0; _i < id.size(); ++_i) {
+            if (_i == 8 || _i == 13 || _i == 18 || _i == 23) {
+                if (id[_i] != '-')
+                    return std::nullopt;
+                continue;
+            }
+
+            const auto _value = from_hex(id[_i]);
+            if (_value < 0)
+                return std::nullopt;
+
+            auto &_half = _digits < 16 ? _key.high_ : _key.low_;
+            _half = (_half << 4) | static_cast<std::uint64_t>(_value);
+            ++_digits;
+        }
+
+        return _key;
+    }
+
+    bool dedup_window::insert(const key &key, const std::chrono::steady_clock::time_point now) {
+        // La llave nula marca los espacios vacíos, no puede ser registrada.
+        if (key == dedup_window::key{})
+            return true;
+
+        const auto _hash = mix(key);
+        auto &_shard = shards_[_hash % shards];
+
+        std::scoped_lock _lock(_shard.mutex_);
+
+        if (now - _shard.rotated_at_ >= ttl_ / 2)
+            rotate(_shard, now);
+
+        const auto &_current = _shard.generations_[_shard.current_];
+        const auto &_previous = _shard.generations_[_shard.current_ ^ 1];
+
+        // La generación anterior solo cuenta mientras su inicio esté dentro del TTL.
+        if (contains(_current, key, _hash) ||
+            (now - _shard.previous_at_ < ttl_ && contains(_previous, key, _hash))) {
+            _shard.hits_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (_current.size_ >= (mask_ + 1) / 2)
+            rotate(_shard, now);
+
+        emplace(_shard.generations_[_shard.current_], key, _hash);
+        _shard.misses_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::uint64_t dedup_window::get_hits() const {
+        std::uint64_t _hits = 0;
+        for (const auto &_shard: shards_)
+            _hits += _shard.hits_.load(std::memory_order_relaxed);
+        return _hits;
+    }
+
+    std::uint64_t dedup_window::get_misses() const {
+        std::uint64_t _misses = 0;
+        for (const auto &_shard: shards_)
+            _misses += _shard.misses_.load(std::memory_order_relaxed);
+        return _misses;
+    }
+
+    std::size_t dedup_window::get_slots() const {
+        return mask_ + 1;
+    }
+
+    bool dedup_window::contains(const generation &generation, const key &key, const std::uint64_t hash) const {
+        for (auto _index = (hash / shards) & mask_;; _index = (_index + 1) & mask_) {
+            const auto &_slot = generation.slots_[_index];
+            if (_slot == key)
+                return true;
+            if (_slot == dedup_window::key{})
+                return false;
+        }
+    }
+
+    void dedup_window::emplace(generation &generation, const key &key, const std::uint64_t hash) const {
+        auto _index = (hash / shards) & mask_;
+        while (generation.slots_[_index] != dedup_window::key{})
+            _index = (_index + 1) & mask_;
+
+        generation.slots_[_index] = key;
+        ++generation.size_;
+    }
+
+    void dedup_window::rotate(shard &shard, const std::chrono::steady_clock::time_point now) const {
+        shard.current_ ^= 1;
+
+        auto &_current = shard.generations_[shard.current_];
+        std::ranges::fill(_current.slots_, key{});
+        _current.size_ = 0;
+
+        shard.previous_at_ = shard.rotated_at_;
+        shard.rotated_at_ = now;
+    }
+} // namespace engine
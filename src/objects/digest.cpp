@@ -0,0 +1,105 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/digest.hpp>
+
+namespace engine {
+    namespace {
+        /**
+         * FNV Offset Basis
+         */
+        constexpr std::uint64_t fnv_offset_basis = 14695981039346656037ULL;
+
+        /**
+         * FNV Prime
+         */
+        constexpr std::uint64_t fnv_prime = 1099511628211ULL;
+
+        /**
+         * Hash
+         *
+         * FNV-1a, stable across builds so States of different binaries agree.
+         *
+         * @param hash
+         * @param data
+         * @param size
+         * @return uint64_t
+         */
+        std::uint64_t hash(std::uint64_t hash, const unsigned char *data, const std::size_t size) {
+            for (std::size_t _i = 0; _i < size; ++_i) {
+                hash ^= data[_i];
+                hash *= fnv_prime;
+            }
+            return hash;
+        }
+
+        /**
+         * Hash Client
+         *
+         * @param client_id
+         * @return uint64_t
+         */
+        std::uint64_t hash_client(const boost::uuids::uuid &client_id) {
+            return hash(fnv_offset_basis, client_id.begin(), client_id.size());
+        }
+
+        /**
+         * To Entry
+         *
+         * Se limita a 63 bits para que viaje como entero con signo en JSON.
+         *
+         * @param hash
+         * @return int64_t
+         */
+        std::int64_t to_entry(const std::uint64_t hash) {
+            return static_cast<std::int64_t>(hash & 0x7fffffffffffffffULL);
+        }
+    }
+
+    std::size_t digest::get_bucket(const boost::uuids::uuid &client_id) {
+        return hash_client(client_id) % buckets;
+    }
+
+    void digest::add_client(const boost::uuids::uuid &client_id) {
+        hashes_[get_bucket(client_id)] ^= to_entry(hash_client(client_id));
+    }
+
+    void digest::add_subscription(const boost::uuids::uuid &client_id, const std::string_view channel) {
+        constexpr unsigned char _separator = 0xff;
+
+        auto _hash = hash(hash_client(client_id), &_separator, 1);
+        _hash = hash(_hash, reinterpret_cast<const unsigned char *>(channel.data()), channel.size());
+
+        hashes_[get_bucket(client_id)] ^= to_entry(_hash);
+    }
+
+    std::vector<std::size_t> digest::compare(const digest &other) const {
+        std::vector<std::size_t> _result;
+        for (std::size_t _bucket = 0; _bucket < buckets; ++_bucket) {
+            if (hashes_[_bucket] != other.hashes_[_bucket])
+                _result.push_back(_bucket);
+        }
+        return _result;
+    }
+
+    boost::json::array digest::to_array() const {
+        boost::json::array _result;
+        _result.reserve(buckets);
+        for (const auto _hash: hashes_)
+            _result.emplace_back(_hash);
+        return _result;
+    }
+
+    std::optional<digest> digest::from_array(const boost::json::array &array) {
+        if (array.size() != buckets)
+            return std::nullopt;
+
+        digest _result;
+        for (std::size_t _bucket = 0; _bucket < buckets; ++_bucket) {
+            if (!array[_bucket].is_int64())
+                return std::nullopt;
+            _result.hashes_[_bucket] = array[_bucket].as_int64();
+        }
+        return _result;
+    }
+} // namespace engine
@@ -0,0 +1,192 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/handlers/batch_handler.hpp>
+
+#include <engine/handlers/subscribe_handler.hpp>
+#include <engine/handlers/unsubscribe_handler.hpp>
+
+#include <engine/kernel.hpp>
+#include <engine/state.hpp>
+#include <engine/request.hpp>
+#include <engine/response.hpp>
+#include <engine/validator.hpp>
+
+#include <engine/validators/batch_validator.hpp>
+#include <engine/validators/subscriptions_validator.hpp>
+
+#include <engine/utils.hpp>
+#include <engine/logger.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include <string_view>
+#include <vector>
+
+namespace engine::handlers {
+    namespace {
+        /**
+         * Get Action
+         *
+         * @param data
+         * @return string_view Empty when the request has no valid header
+         */
+        std::string_view get_action(const boost::json::object &data) {
+            if (const validator _validator(data); !_validator.get_passed())
+                return {};
+
+            return data.at("action").as_string();
+        }
+
+        /**
+         * Is Groupable
+         *
+         * @param data
+         * @param action
+         * @return bool True for single channel subscribe or unsubscribe requests
+         */
+        bool is_groupable(const boost::json::object &data, const std::string_view action) {
+            if (action != "subscribe" && action != "unsubscribe")
+                return false;
+
+            // Las peticiones con varios canales ya se aplican en bloque por su handler.
+            const auto *_params = data.if_contains("params");
+            return _params == nullptr || !_params->is_object() || !_params->as_object().contains("channels");
+        }
+
+        /**
+         * Process Group
+         *
+         * Applies a run of subscribe or unsubscribe requests under a single lock of the State.
+         *
+         * @param request
+         * @param requests
+         * @param subscribe
+         * @param responses
+         * @param propagation
+         * @return bool True when the subscriptions changed
+         */
+        bool process_group(const request &request, const std::vector<const boost::json::object *> &requests,
+                           const bool subscribe, boost::json::array &responses, boost::json::array &propagation) {
+            auto &_state = request.state_;
+
+            std::vector<std::shared_ptr<response> > _responses;
+            _responses.reserve(requests.size());
+
+            std::vector<engine::request> _requests;
+            _requests.reserve(requests.size());
+
+            std::vector<std::size_t> _valid;
+            std::vector<subscription> _subscriptions;
+
+            for (const auto *_data: requests) {
+                _responses.emplace_back(std::make_shared<response>());
+                _requests.push_back(engine::request{
+                    .transaction_id_ = get_param_as_id(*_data, "transaction_id"),
+                    .response_ = _responses.back(),
+                    .entity_id_ = request.entity_id_,
+                    .context_ = request.context_,
+                    .state_ = _state,
+                    .data_ = *_data,
+                    .timestamp_ = request.timestamp_,
+                });
+
+                const auto &_request = _requests.back();
+                if (!validators::subscriptions_validator(_request))
+                    continue;
+
+                const auto &_params = get_params(_request);
+                const auto _is_client = request.context_ == on_client;
+
+                _valid.push_back(_requests.size() - 1);
+                _subscriptions.push_back(subscription{
+                    _is_client ? _state->get_id() : request.entity_id_,
+                    _is_client ? request.entity_id_ : get_param_as_id(_params, "client_id"),
+                    get_param_as_string(_params, "channel"),
+                });
+            }
+
+            const auto _results = subscribe ? _state->subscribe(_subscriptions) : _state->unsubscribe(_subscriptions);
+
+            bool _changed = false;
+            for (std::size_t _i = 0; _i < _valid.size(); ++_i) {
+                const auto &_request = _requests[_valid[_i]];
+                const auto &_channel = _subscriptions[_i].channel_;
+                const bool _success = _results[_i];
+                _changed = _changed || _success;
+
+                if (request.context_ == on_session) {
+                    next(_request, get_status(_success));
+                    continue;
+                }
+
+                if (subscribe) {
+                    on_subscribed(_request, _channel, _success);
+                    propagation.push_back(make_subscribe_request_object(_request, request.entity_id_, _channel));
+                } else {
+                    on_unsubscribed(_request, _channel, _success);
+                    propagation.push_back(make_unsubscribe_request_object(_request, request.entity_id_, _channel));
+                }
+            }
+
+            for (const auto &_response: _responses) {
+                _response->mark_as_processed();
+                responses.push_back(_response->get_data());
+            }
+
+            return _changed;
+        }
+    }
+
+    void batch_handler(const request &request) {
+        auto &_state = request.state_;
+
+        if (validators::batch_validator(request)) {
+            const auto &_requests = get_params(request).at("requests").as_array();
+
+            boost::json::array _responses;
+            _responses.reserve(_requests.size());
+
+            boost::json::array _propagation;
+            bool _changed = false;
+
+            std::vector<const boost::json::object *> _group;
+
+            for (std::size_t _begin = 0; _begin < _requests.size();) {
+                const auto &_first = _requests[_begin].as_object();
+                const auto _action = get_action(_first);
+
+                // Solo las suscripciones se agrupan, el resto se despacha como si llegara por separado.
+                if (!is_groupable(_first, _action)) {
+                    _responses.push_back(kernel(_state, _first, request.context_, request.entity_id_)->get_data());
+                    ++_begin;
+                    continue;
+                }
+
+                _group.clear();
+                auto _end = _begin;
+                while (_end < _requests.size() && get_action(_requests[_end].as_object()) == _action &&
+                       is_groupable(_requests[_end].as_object(), _action))
+                    _group.push_back(&_requests[_end++].as_object());
+
+                _changed = process_group(request, _group, _action == "subscribe", _responses, _propagation) ||
+                           _changed;
+                _begin = _end;
+            }
+
+            next(request, "ok", {{"responses", _responses}});
+
+            // Los cambios de suscripción viajan a los pares en un único mensaje.
+            if (request.context_ == on_client && !_propagation.empty()) {
+                auto _ = _state->batch_to_sessions(request, _propagation);
+                boost::ignore_unused(_);
+            }
+
+            if (request.context_ == on_session && _changed)
+                _state->relay(request);
+
+            LOG_INFO("state_id=[{}] action=[batch] context=[{}] entity_id=[{}] requests=[{}] propagated=[{}]",
+                     to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                     to_string(request.entity_id_), _requests.size(), _propagation.size());
+        }
+    }
+}
@@ -54,6 +54,8 @@ namespace engine::handlers {
                         _payload
                     );
 
+                    _state->relay(request, to_string(_client_id));
+
                     LOG_INFO(
                         "state_id=[{}] action=[broadcast] context=[{}] session_id=[{}] client_id=[{}] count=[{}] size=[{}]",
                         to_string(_state->get_id()), kernel_context_to_string(request.context_),
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/handlers/confirm_handler.hpp>
+
+#include <engine/state.hpp>
+#include <engine/request.hpp>
+#include <engine/kernel_context.hpp>
+
+#include <engine/validators/confirm_validator.hpp>
+
+#include <engine/utils.hpp>
+#include <engine/logger.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+namespace engine::handlers {
+    void confirm_handler(const request &request) {
+        const auto &_state = request.state_;
+        if (validators::confirm_validator(request)) {
+            const auto &_params = get_params(request);
+
+            switch (request.context_) {
+                case on_client: {
+                    const auto _buffer = _state->get_reliable_buffer(request.entity_id_);
+                    if (_buffer == nullptr) {
+                        next(request, "no effect");
+                        break;
+                    }
+
+                    // La confirmación es acumulativa, libera todo hasta la secuencia indicada.
+                    const auto _released = _buffer->confirm(get_param_as_number(_params, "sequence"));
+
+                    LOG_INFO("state_id=[{}] action=[confirm] context=[{}] client_id=[{}] released=[{}] pending=[{}]",
+                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                             to_string(request.entity_id_), _released, _buffer->get_size());
+
+                    next(request, "ok", {{"released", _released}});
+                    break;
+                }
+                case on_session: {
+                    next(request, "no effect");
+
+                    LOG_INFO("state_id=[{}] action=[confirm] context=[{}] session_id=[{}] status=[{}]",
+                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                             to_string(request.entity_id_), "no effect");
+
+                    break;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/logger.hpp>
+#include <engine/handlers/digest_handler.hpp>
+
+#include <engine/state.hpp>
+#include <engine/request.hpp>
+#include <engine/session.hpp>
+
+#include <engine/validators/digest_validator.hpp>
+
+#include <engine/utils.hpp>
+
+#include <boost/uuid/uuid_io.hpp>
+
+namespace engine::handlers {
+    void digest_handler(const request &request) {
+        auto &_state = request.state_;
+
+        switch (request.context_) {
+            case on_client: {
+                next(request, "no effect");
+                break;
+            }
+            case on_session: {
+                if (validators::digest_validator(request)) {
+                    const auto &_params = get_params(request);
+                    const auto _remote = digest::from_array(_params.at("buckets").as_array());
+                    const auto _version = _params.at("version").as_int64();
+
+                    if (const auto _session = _state->get_session(request.entity_id_); _session.has_value()) {
+                        const auto _buckets = _state->reconcile(_session.value(), _remote.value(), _version);
+
+                        LOG_INFO(
+                            "state_id=[{}] action=[digest] context=[{}] session_id=[{}] version=[{}] buckets=[{}] status=[ok]",
+                            to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                            to_string(request.entity_id_), _version, _buckets);
+
+                        next(request, "ok");
+                    } else {
+                        next(request, "no effect");
+
+                        LOG_INFO("state_id=[{}] action=[digest] context=[{}] status=[no effect]",
+                                 to_string(_state->get_id()), kernel_context_to_string(request.context_));
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
@@ -33,6 +33,9 @@ namespace engine::handlers {
                         std::make_shared<client>(request.entity_id_, _state, _client_id));
                     const auto _status = get_status(_inserted);
 
+                    if (_inserted)
+                        _state->relay(request);
+
                     LOG_INFO("state_id=[{}] action=[join] context=[{}] session_id=[{}] client_id=[{}] status=[{}]",
                              to_string(_state->get_id()), kernel_context_to_string(request.context_),
                              to_string(request.entity_id_), to_string(_client_id), _status);
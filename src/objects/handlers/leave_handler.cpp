@@ -32,6 +32,9 @@ namespace engine::handlers {
                     const auto _removed = _state->remove_client(_client_id);
                     const auto _status = get_status(_removed);
 
+                    if (_removed)
+                        _state->relay(request);
+
                     LOG_INFO("state_id=[{}] action=[leave] context=[{}] session_id=[{}] client_id=[{}] status=[{}]",
                              to_string(_state->get_id()), kernel_context_to_string(request.context_),
                              to_string(request.entity_id_), to_string(_client_id), _status);
@@ -0,0 +1,56 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/logger.hpp>
+#include <engine/handlers/load_handler.hpp>
+
+#include <engine/state.hpp>
+#include <engine/request.hpp>
+#include <engine/session.hpp>
+
+#include <engine/validators/load_validator.hpp>
+
+#include <engine/utils.hpp>
+
+#include <boost/uuid/uuid_io.hpp>
+
+namespace engine::handlers {
+    void load_handler(const request &request) {
+        auto &_state = request.state_;
+
+        switch (request.context_) {
+            case on_client: {
+                next(request, "no effect");
+                break;
+            }
+            case on_session: {
+                if (validators::load_validator(request)) {
+                    const auto &_params = get_params(request);
+                    const load _load{
+                        .clients_ = get_param_as_number(_params, "clients"),
+                        .rate_ = _params.at("rate").to_number<double>(),
+                        .queued_ = get_param_as_number(_params, "queued"),
+                        .draining_ = _params.contains("draining") && get_param_as_bool(_params, "draining"),
+                    };
+
+                    if (const auto _session = _state->get_session(request.entity_id_); _session.has_value()) {
+                        _session.value()->set_load(_load);
+
+                        LOG_INFO(
+                            "state_id=[{}] action=[load] context=[{}] session_id=[{}] clients=[{}] rate=[{}] queued=[{}] status=[ok]",
+                            to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                            to_string(request.entity_id_), _load.clients_, _load.rate_, _load.queued_);
+
+                        next(request, "ok");
+                    } else {
+                        next(request, "no effect");
+
+                        LOG_INFO("state_id=[{}] action=[load] context=[{}] status=[no effect]",
+                                 to_string(_state->get_id()), kernel_context_to_string(request.context_));
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
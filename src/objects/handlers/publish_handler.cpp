@@ -59,6 +59,8 @@ namespace engine::handlers {
                         _payload
                     );
 
+                    _state->relay_to_subscribed(request, _channel);
+
                     LOG_INFO(
                         "state_id=[{}] action=[publish] context=[{}] session_id=[{}] client_id=[{}] channel=[{}] count=[{}] size=[{}]",
                         to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
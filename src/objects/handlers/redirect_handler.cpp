@@ -0,0 +1,38 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/logger.hpp>
+#include <engine/handlers/redirect_handler.hpp>
+
+#include <engine/state.hpp>
+#include <engine/request.hpp>
+#include <engine/session.hpp>
+
+#include <engine/utils.hpp>
+
+#include <boost/uuid/uuid_io.hpp>
+
+namespace engine::handlers {
+    void redirect_handler(const request &request) {
+        auto &_state = request.state_;
+
+        switch (request.context_) {
+            case on_client: {
+                if (const auto _redirect = _state->get_redirect()) {
+                    LOG_INFO("state_id=[{}] action=[redirect] context=[{}] client_id=[{}] host=[{}] clients_port=[{}] status=[ok]",
+                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                             to_string(request.entity_id_), _redirect->get_host(), _redirect->get_clients_port());
+
+                    next(request, "ok", make_redirect_object(_redirect));
+                } else {
+                    next(request, "no effect");
+                }
+                break;
+            }
+            case on_session: {
+                next(request, "no effect");
+                break;
+            }
+        }
+    }
+}
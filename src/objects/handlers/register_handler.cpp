@@ -15,6 +15,50 @@
 #include <boost/uuid/uuid_io.hpp>
 
 namespace engine::handlers {
+    namespace {
+        /**
+         * Register Lane
+         *
+         * @param request
+         */
+        void register_lane(const request &request) {
+            auto &_state = request.state_;
+            const auto &_params = get_params(request);
+            const auto _lane = static_cast<unsigned short>(get_param_as_number(_params, "lane"));
+            const auto _node_id = get_param_as_id(_params, "state_id");
+
+            const auto _session = _state->get_session(request.entity_id_);
+
+            std::shared_ptr<session> _primary;
+            for (const auto &_candidate: _state->get_sessions()) {
+                if (_candidate->get_id() != request.entity_id_ && _candidate->get_registered() &&
+                    _candidate->get_node_id() == _node_id) {
+                    _primary = _candidate;
+                    break;
+                }
+            }
+
+            if (!_session.has_value() || !_primary) {
+                next(request, "no effect");
+
+                LOG_INFO("state_id=[{}] action=[register] context=[{}] lane=[{}] status=[no effect]",
+                         to_string(_state->get_id()), kernel_context_to_string(request.context_), _lane);
+                return;
+            }
+
+            // El carril deja de ser una sesión del estado y pasa a actuar en nombre de la principal.
+            _state->remove_session(request.entity_id_);
+            _primary->attach_lane(_session.value(), _lane);
+
+            LOG_INFO(
+                "state_id=[{}] action=[register] context=[{}] session_id=[{}] peer_id=[{}] lane=[{}] status=[ok]",
+                to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                to_string(request.entity_id_), to_string(_primary->get_id()), _lane);
+
+            next(request, "ok");
+        }
+    }
+
     void register_handler(const request &request) {
         auto &_state = request.state_;
 
@@ -30,12 +74,24 @@ namespace engine::handlers {
                     const auto _clients_port = get_param_as_number(_params, "clients_port");
                     const auto _registered = get_param_as_bool(_params, "registered");
 
+                    if (_params.contains("lane") && get_param_as_number(_params, "lane") > 0) {
+                        register_lane(request);
+                        break;
+                    }
+
                     if (const auto _session = _state->get_session(request.entity_id_); _session.has_value()) {
                         const auto &_instance = _session.value();
                         _instance->set_clients_port(_clients_port);
                         _instance->set_sessions_port(_sessions_port);
                         _instance->mark_as_registered();
 
+                        // La instancia remota puede volver con el mismo nodo, se recupera lo retenido de ella.
+                        if (_params.contains("state_id")) {
+                            const auto _node_id = get_param_as_id(_params, "state_id");
+                            _instance->set_node_id(_node_id);
+                            _instance->set_peer_version(_state->adopt_state_of_session(request.entity_id_, _node_id));
+                        }
+
                         LOG_INFO(
                             "state_id=[{}] action=[register] context=[{}] session_id=[{}] sessions_port=[{}] clients_port=[{}] registered=[{}] status=[ok]",
                             to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
@@ -43,7 +99,11 @@ namespace engine::handlers {
 
                         _state->sync(_instance, _registered);
 
-                        next(request, "ok");
+                        next(request, "ok", {
+                                 {"state_id", to_string(_state->get_id())},
+                                 {"digest", _state->get_digest(request.entity_id_).to_array()},
+                                 {"version", _state->get_version()},
+                             });
                     } else {
                         next(request, "no effect");
 
@@ -0,0 +1,74 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/handlers/reliable_handler.hpp>
+
+#include <engine/state.hpp>
+#include <engine/client.hpp>
+#include <engine/request.hpp>
+#include <engine/kernel_context.hpp>
+
+#include <engine/validators/reliable_validator.hpp>
+
+#include <engine/utils.hpp>
+#include <engine/logger.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+namespace engine::handlers {
+    void reliable_handler(const request &request) {
+        const auto &_state = request.state_;
+        if (validators::reliable_validator(request)) {
+            const auto &_params = get_params(request);
+
+            switch (request.context_) {
+                case on_client: {
+                    const auto _client = _state->get_client(request.entity_id_);
+                    if (_state->get_config()->reliable_messages_ == 0 || !_client.has_value()) {
+                        next(request, "no effect");
+                        break;
+                    }
+
+                    // Si no hay nada que retomar el cliente empieza con un buffer nuevo y lo sabe por resumed.
+                    std::shared_ptr<reliable_buffer> _buffer;
+                    if (_params.contains("client_id")) {
+                        _buffer = _state->resume_reliable(
+                            request.entity_id_, get_param_as_id(_params, "client_id"),
+                            _params.at("token").as_string(),
+                            _params.contains("sequence") ? get_param_as_number(_params, "sequence") : 0);
+                    }
+
+                    const auto _resumed = _buffer != nullptr;
+                    if (!_resumed)
+                        _buffer = _state->enable_reliable(request.entity_id_);
+
+                    const auto _redelivered = _resumed ? _buffer->get_size() : 0;
+                    _client.value()->set_reliable(_buffer, _resumed);
+
+                    LOG_INFO("state_id=[{}] action=[reliable] context=[{}] client_id=[{}] resumed=[{}] redelivered=[{}]",
+                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                             to_string(request.entity_id_), _resumed, _redelivered);
+
+                    // Con first_sequence mayor a lo recibido más uno el cliente sabe que hubo entregas descartadas.
+                    next(request, "ok", {
+                             {"resumed", _resumed},
+                             {"redelivered", _redelivered},
+                             {"first_sequence", _buffer->get_first_sequence()},
+                             {"next_sequence", _buffer->get_next_sequence()},
+                             {"dropped", _buffer->get_dropped()},
+                             {"token", _buffer->get_token()},
+                         });
+                    break;
+                }
+                case on_session: {
+                    next(request, "no effect");
+
+                    LOG_INFO("state_id=[{}] action=[reliable] context=[{}] session_id=[{}] status=[{}]",
+                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                             to_string(request.entity_id_), "no effect");
+
+                    break;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/logger.hpp>
+#include <engine/handlers/resync_handler.hpp>
+
+#include <engine/state.hpp>
+#include <engine/request.hpp>
+#include <engine/session.hpp>
+
+#include <engine/validators/resync_validator.hpp>
+
+#include <engine/utils.hpp>
+
+#include <boost/uuid/uuid_io.hpp>
+
+namespace engine::handlers {
+    void resync_handler(const request &request) {
+        auto &_state = request.state_;
+
+        switch (request.context_) {
+            case on_client: {
+                next(request, "no effect");
+                break;
+            }
+            case on_session: {
+                if (validators::resync_validator(request)) {
+                    const auto &_params = get_params(request);
+
+                    std::vector<std::size_t> _buckets;
+                    for (const auto &_bucket: _params.at("buckets").as_array())
+                        _buckets.push_back(static_cast<std::size_t>(_bucket.as_int64()));
+
+                    if (const auto _session = _state->get_session(request.entity_id_); _session.has_value()) {
+                        const auto _count = _state->send_buckets(_session.value(), _buckets);
+
+                        LOG_INFO(
+                            "state_id=[{}] action=[resync] context=[{}] session_id=[{}] buckets=[{}] entries=[{}] status=[ok]",
+                            to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                            to_string(request.entity_id_), _buckets.size(), _count);
+
+                        next(request, "ok");
+                    } else {
+                        next(request, "no effect");
+
+                        LOG_INFO("state_id=[{}] action=[resync] context=[{}] status=[no effect]",
+                                 to_string(_state->get_id()), kernel_context_to_string(request.context_));
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
@@ -87,6 +87,13 @@ namespace engine::handlers {
                                 to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
                                 to_string(_from_client_id), to_string(_scoped_client->get_id()), _payload.size());
                             next(request, "ok");
+                        } else if (_state->relay_to_session(request, _scoped_client->get_session_id(),
+                                                            to_string(_scoped_client->get_id()))) {
+                            LOG_INFO(
+                                "state_id=[{}] action=[send] context=[{}] from_client_id=[{}] to_client_id=[{}] status=[relayed] size=[{}]",
+                                to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
+                                to_string(_from_client_id), to_string(_scoped_client->get_id()), _payload.size());
+                            next(request, "ok");
                         } else {
                             next(request, "no effect");
                         }
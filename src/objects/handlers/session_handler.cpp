@@ -6,27 +6,34 @@
 
 #include <engine/state.hpp>
 #include <engine/request.hpp>
+#include <engine/async_request.hpp>
 #include <engine/session.hpp>
 
 #include <engine/validators/session_validator.hpp>
 
 #include <engine/utils.hpp>
+#include <boost/asio/connect.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/strand.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
 
 #include <boost/uuid/uuid_io.hpp>
 
 namespace engine::handlers {
-    void session_handler(const request &request) {
-        auto &_state = request.state_;
+    boost::asio::awaitable<void> session_handler(async_request request) {
+        const auto _request = request.to_request();
+        auto &_state = _request.state_;
 
-        switch (request.context_) {
+        switch (_request.context_) {
             case on_client: {
-                next(request, "no effect");
+                next(_request, "no effect");
                 break;
             }
             case on_session: {
-                if (validators::session_validator(request)) {
-                    const auto &_params = get_params(request);
+                if (validators::session_validator(_request)) {
+                    const auto &_params = get_params(_request);
                     const auto _host = get_param_as_string(_params, "host");
                     const auto _sessions_port = get_param_as_number(_params, "sessions_port");
                     const auto _clients_port = get_param_as_number(_params, "clients_port");
@@ -41,21 +48,28 @@ namespace engine::handlers {
                     }
 
                     if (!_found) {
-                        boost::asio::ip::tcp::resolver _resolver{make_strand(_state->get_ioc())};
-                        auto const _results = _resolver.resolve(_host, std::to_string(_sessions_port));
+                        // La resolución y la conexión suspenden el handler, la conexión sigue leyendo.
+                        const auto _executor = co_await boost::asio::this_coro::executor;
+                        boost::asio::ip::tcp::resolver _resolver{_executor};
+                        auto const _results = co_await _resolver.async_resolve(
+                            _host, std::to_string(_sessions_port), boost::asio::use_awaitable);
                         const auto _remote_session = std::make_shared<session>(
                             _state, boost::asio::ip::tcp::socket{make_strand(_state->get_ioc())}, remote);
                         auto &_socket = _remote_session->get_socket();
                         auto &_lowest_socket = _socket.next_layer().lowest_layer();
                         while (!_lowest_socket.is_open()) {
-                            try {
-                                boost::asio::connect(_lowest_socket, _results);
-                            } catch (std::exception &e) {
-                                LOG_INFO("Connection refused ... retrying : {}", e.what());
-                                boost::system::error_code _ec;
-                                _lowest_socket.close(_ec);
-                                std::this_thread::sleep_for(std::chrono::seconds(3));
-                            }
+                            boost::system::error_code _ec;
+                            co_await boost::asio::async_connect(_lowest_socket, _results,
+                                                                boost::asio::redirect_error(
+                                                                    boost::asio::use_awaitable, _ec));
+                            if (!_ec)
+                                break;
+
+                            LOG_INFO("Connection refused ... retrying : {}", _ec.message());
+                            _lowest_socket.close(_ec);
+
+                            boost::asio::steady_timer _timer{_executor, std::chrono::seconds(3)};
+                            co_await _timer.async_wait(boost::asio::use_awaitable);
                         }
                         _remote_session->set_clients_port(_clients_port);
                         _remote_session->set_sessions_port(_sessions_port);
@@ -63,15 +77,15 @@ namespace engine::handlers {
                         _state->add_session(_remote_session);
                         LOG_INFO(
                             "state_id=[{}] action=[session] context=[{}] session_id=[{}] host=[{}] sessions_port=[{}] clients_port=[{}] status=[ok]",
-                            to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
+                            to_string(_state->get_id()), kernel_context_to_string(_request.context_),
                             to_string(_remote_session->get_id()), _host, _sessions_port, _clients_port);
 
-                        next(request, "ok");
+                        next(_request, "ok");
                     } else {
                         LOG_INFO("state_id=[{}] action=[session] context=[{}] status=[no effect]",
-                                 to_string(request.state_->get_id()), kernel_context_to_string(request.context_));
+                                 to_string(_state->get_id()), kernel_context_to_string(_request.context_));
 
-                        next(request, "no effect");
+                        next(_request, "no effect");
                     }
                 }
                 break;
@@ -4,6 +4,7 @@
 #include <engine/handlers/subscribe_handler.hpp>
 
 #include <engine/state.hpp>
+#include <engine/client.hpp>
 #include <engine/request.hpp>
 
 #include <engine/validators/subscriptions_validator.hpp>
@@ -12,19 +13,127 @@
 #include <engine/logger.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
+#include <algorithm>
+
 namespace engine::handlers {
+    namespace {
+        /**
+         * Deliver
+         *
+         * Applies the options of a client subscription, the replay or the last value are queued before the reply.
+         *
+         * @param request
+         * @param channel
+         * @return optional<size_t> Replayed messages when a replay was requested
+         */
+        std::optional<std::size_t> deliver(const request &request, const std::string &channel) {
+            auto &_state = request.state_;
+            const auto &_params = get_params(request);
+
+            if (_params.contains("conflate")) {
+                if (const auto _client = _state->get_client(request.entity_id_); _client.has_value())
+                    _client.value()->set_conflated(channel, get_param_as_bool(_params, "conflate"));
+            }
+
+            if (!_params.contains("since") && !_params.contains("since_timestamp")) {
+                _state->send_last_value(request.entity_id_, channel);
+                return std::nullopt;
+            }
+
+            return _state->replay(
+                request.entity_id_, channel,
+                _params.contains("since")
+                    ? std::optional<std::uint64_t>(get_param_as_number(_params, "since"))
+                    : std::nullopt,
+                _params.contains("since_timestamp")
+                    ? std::optional<std::int64_t>(_params.at("since_timestamp").as_int64())
+                    : std::nullopt);
+        }
+
+        /**
+         * Subscribe Channels
+         *
+         * @param request
+         */
+        void subscribe_channels(const request &request) {
+            auto &_state = request.state_;
+            const auto &_params = get_params(request);
+            const auto _channels = get_param_as_strings(_params, "channels");
+
+            switch (request.context_) {
+                case on_client: {
+                    const auto _results = _state->subscribe(
+                        make_subscriptions(_state->get_id(), request.entity_id_, _channels));
+                    const auto _status = get_status(std::ranges::find(_results, true) != _results.end());
+
+                    boost::json::object _statuses;
+                    std::size_t _replayed = 0;
+                    for (std::size_t _i = 0; _i < _channels.size(); ++_i) {
+                        _statuses[_channels[_i]] = get_status(_results[_i]);
+                        _replayed += deliver(request, _channels[_i]).value_or(0);
+                    }
+
+                    if (_params.contains("since_timestamp"))
+                        next(request, _status, {{"channels", _statuses}, {"replayed", _replayed}});
+                    else
+                        next(request, _status, {{"channels", _statuses}});
+
+                    // Los pares reciben el conjunto completo en un único mensaje.
+                    auto _ = _state->subscribe_to_sessions(request, request.entity_id_, _channels);
+                    boost::ignore_unused(_);
+                    LOG_INFO("state_id=[{}] action=[subscribe] context=[{}] client_id=[{}] channels=[{}] status=[{}]",
+                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                             to_string(request.entity_id_), _channels.size(), _status);
+                }
+                break;
+                case on_session: {
+                    const auto &_client_id = get_param_as_id(_params, "client_id");
+                    const auto _results = _state->subscribe(
+                        make_subscriptions(request.entity_id_, _client_id, _channels));
+                    const bool _success = std::ranges::find(_results, true) != _results.end();
+                    const auto _status = get_status(_success);
+
+                    if (_success)
+                        _state->relay(request);
+
+                    LOG_INFO(
+                        "state_id=[{}] action=[subscribe] context=[{}] session_id=[{}] client_id=[{}] channels=[{}] status=[{}]",
+                        to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                        to_string(request.entity_id_), to_string(_client_id), _channels.size(), _status);
+                    next(request, _status);
+                }
+                break;
+            }
+        }
+    }
+
+    void on_subscribed(const request &request, const std::string &channel, const bool success) {
+        const auto _status = get_status(success);
+
+        if (const auto _replayed = deliver(request, channel); _replayed.has_value())
+            next(request, _status, {{"replayed", _replayed.value()}});
+        else
+            next(request, _status);
+    }
+
     void subscribe_handler(const request &request) {
         auto &_state = request.state_;
 
         if (validators::subscriptions_validator(request)) {
             const auto &_params = get_params(request);
+            if (_params.contains("channels")) {
+                subscribe_channels(request);
+                return;
+            }
+
             const auto _channel = get_param_as_string(_params, "channel");
 
             switch (request.context_) {
                 case on_client: {
                     const bool _success = _state->subscribe(_state->get_id(), request.entity_id_, _channel);
                     const auto _status = get_status(_success);
-                    next(request, _status);
+
+                    on_subscribed(request, _channel, _success);
 
                     auto _ = _state->subscribe_to_sessions(request, request.entity_id_, _channel);
                     boost::ignore_unused(_);
@@ -38,6 +147,9 @@ namespace engine::handlers {
                     const bool _success = _state->subscribe(request.entity_id_, _client_id, _channel);
                     const auto _status = get_status(_success);
 
+                    if (_success)
+                        _state->relay(request);
+
                     LOG_INFO(
                         "state_id=[{}] action=[subscribe] context=[{}] session_id=[{}] client_id=[{}] channel=[{}] status=[{}]",
                         to_string(_state->get_id()), kernel_context_to_string(request.context_),
@@ -4,6 +4,7 @@
 #include <engine/handlers/unsubscribe_handler.hpp>
 
 #include <engine/state.hpp>
+#include <engine/client.hpp>
 #include <engine/request.hpp>
 
 #include <engine/validators/subscriptions_validator.hpp>
@@ -12,19 +13,94 @@
 #include <engine/logger.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
+#include <algorithm>
+
 namespace engine::handlers {
+    namespace {
+        /**
+         * Unsubscribe Channels
+         *
+         * @param request
+         */
+        void unsubscribe_channels(const request &request) {
+            auto &_state = request.state_;
+            const auto &_params = get_params(request);
+            const auto _channels = get_param_as_strings(_params, "channels");
+
+            switch (request.context_) {
+                case on_client: {
+                    const auto _results = _state->unsubscribe(
+                        make_subscriptions(_state->get_id(), request.entity_id_, _channels));
+                    const auto _status = get_status(std::ranges::find(_results, true) != _results.end());
+
+                    const auto _client = _state->get_client(request.entity_id_);
+
+                    boost::json::object _statuses;
+                    for (std::size_t _i = 0; _i < _channels.size(); ++_i) {
+                        _statuses[_channels[_i]] = get_status(_results[_i]);
+                        if (_client.has_value())
+                            _client.value()->set_conflated(_channels[_i], false);
+                    }
+
+                    next(request, _status, {{"channels", _statuses}});
+
+                    auto _ = _state->unsubscribe_to_sessions(request, request.entity_id_, _channels);
+                    boost::ignore_unused(_);
+
+                    LOG_INFO("state_id=[{}] action=[unsubscribe] context=[{}] client_id=[{}] channels=[{}] status=[{}]",
+                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                             to_string(request.entity_id_), _channels.size(), _status);
+                }
+                break;
+                case on_session: {
+                    const auto &_client_id = get_param_as_id(_params, "client_id");
+                    const auto _results = _state->unsubscribe(
+                        make_subscriptions(request.entity_id_, _client_id, _channels));
+                    const bool _success = std::ranges::find(_results, true) != _results.end();
+                    const auto _status = get_status(_success);
+
+                    if (_success)
+                        _state->relay(request);
+
+                    LOG_INFO(
+                        "state_id=[{}] action=[unsubscribe] context=[{}] session_id=[{}] client_id=[{}] channels=[{}] status=[{}]",
+                        to_string(_state->get_id()), kernel_context_to_string(request.context_),
+                        to_string(request.entity_id_), to_string(_client_id), _channels.size(), _status);
+
+                    next(request, _status);
+                }
+                break;
+            }
+        }
+    }
+
+    void on_unsubscribed(const request &request, const std::string &channel, const bool success) {
+        auto &_state = request.state_;
+
+        if (const auto _client = _state->get_client(request.entity_id_); _client.has_value())
+            _client.value()->set_conflated(channel, false);
+
+        next(request, get_status(success));
+    }
+
     void unsubscribe_handler(const request &request) {
         auto &_state = request.state_;
 
         if (validators::subscriptions_validator(request)) {
             const auto &_params = get_params(request);
+            if (_params.contains("channels")) {
+                unsubscribe_channels(request);
+                return;
+            }
+
             const auto _channel = get_param_as_string(_params, "channel");
 
             switch (request.context_) {
                 case on_client: {
                     const bool _success = _state->unsubscribe(_state->get_id(), request.entity_id_, _channel);
                     const auto _status = get_status(_success);
-                    next(request, _status);
+
+                    on_unsubscribed(request, _channel, _success);
 
                     auto _ = _state->unsubscribe_to_sessions(request, request.entity_id_, _channel);
                     boost::ignore_unused(_);
@@ -39,6 +115,9 @@ namespace engine::handlers {
                     const bool _success = _state->unsubscribe(request.entity_id_, _client_id, _channel);
                     const auto _status = get_status(_success);
 
+                    if (_success)
+                        _state->relay(request);
+
                     LOG_INFO(
                         "state_id=[{}] action=[unsubscribe] context=[{}] session_id=[{}] client_id=[{}] channel=[{}] status=[{}]",
                         to_string(_state->get_id()), kernel_context_to_string(request.context_),
@@ -10,10 +10,17 @@
 #include <engine/state.hpp>
 #include <engine/logger.hpp>
 #include <engine/validator.hpp>
+#include <engine/rate_limiter.hpp>
+#include <engine/async_request.hpp>
+#include <engine/cost.hpp>
 
 #include <engine/handlers/ping_handler.hpp>
 #include <engine/handlers/register_handler.hpp>
 #include <engine/handlers/session_handler.hpp>
+#include <engine/handlers/digest_handler.hpp>
+#include <engine/handlers/resync_handler.hpp>
+#include <engine/handlers/load_handler.hpp>
+#include <engine/handlers/redirect_handler.hpp>
 
 #include <engine/handlers/join_handler.hpp>
 #include <engine/handlers/leave_handler.hpp>
@@ -28,25 +35,274 @@
 #include <engine/handlers/publish_handler.hpp>
 #include <engine/handlers/send_handler.hpp>
 
+#include <engine/handlers/batch_handler.hpp>
+
+#include <engine/handlers/reliable_handler.hpp>
+#include <engine/handlers/confirm_handler.hpp>
+
 #include <engine/handlers/unimplemented_handler.hpp>
 
 #include <engine/utils.hpp>
 
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/json/serialize.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
 namespace engine {
+    namespace {
+        /**
+         * Make Rate Limited Message
+         *
+         * @param data
+         * @return shared_ptr<string const> Rejection carrying the transaction id of the request
+         */
+        std::shared_ptr<std::string const> make_rate_limited_message(const boost::json::object &data) {
+            boost::json::value _transaction_id = nullptr;
+            if (const auto *_value = data.if_contains("transaction_id"); _value != nullptr && _value->is_string())
+                _transaction_id = _value->as_string();
+
+            return std::make_shared<std::string const>(serialize(boost::json::object{
+                {"transaction_id", _transaction_id},
+                {"action", "ack"},
+                {"status", "failed"},
+                {"message", "too many requests"},
+            }));
+        }
+
+        /**
+         * Is Allowed
+         *
+         * @param state
+         * @param data
+         * @param limiter
+         * @return bool
+         */
+        bool is_allowed(const std::shared_ptr<state> &state, const boost::json::object &data, rate_limiter *limiter) {
+            const auto _channel_limited = state->get_config()->channel_rate_limit_ > 0;
+            if ((limiter == nullptr || !limiter->is_enabled()) && !_channel_limited)
+                return true;
+
+            // Se evalúa antes de validar, los mensajes inválidos también consumen del cliente.
+            std::string_view _action;
+            if (const auto *_value = data.if_contains("action"); _value != nullptr && _value->is_string())
+                _action = _value->as_string();
+
+            const auto _now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+
+            if (limiter != nullptr && !limiter->consume(_action, _now))
+                return false;
+
+            // Cada elemento del lote consume como si llegara por separado, los canales se evalúan al despacharlo.
+            if (_action == "batch" && limiter != nullptr) {
+                const auto *_params = data.if_contains("params");
+                const auto *_requests = _params != nullptr && _params->is_object()
+                                            ? _params->as_object().if_contains("requests")
+                                            : nullptr;
+                if (_requests == nullptr || !_requests->is_array())
+                    return true;
+
+                for (const auto &_item: _requests->as_array()) {
+                    std::string_view _item_action;
+                    if (const auto *_value = _item.is_object() ? _item.as_object().if_contains("action") : nullptr;
+                        _value != nullptr && _value->is_string())
+                        _item_action = _value->as_string();
+
+                    if (!limiter->consume(_item_action, _now))
+                        return false;
+                }
+            }
+
+            if (!_channel_limited || _action != "publish")
+                return true;
+
+            const auto *_params = data.if_contains("params");
+            if (_params == nullptr || !_params->is_object())
+                return true;
+
+            const auto *_channel = _params->as_object().if_contains("channel");
+            if (_channel == nullptr || !_channel->is_string())
+                return true;
+
+            return state->allow_publish(_channel->as_string(), _now);
+        }
+
+        /**
+         * Spawn
+         *
+         * @param request
+         * @param handler
+         * @param executor
+         * @param completion
+         */
+        void spawn(const request &request, boost::asio::awaitable<void> handler,
+                   const boost::asio::any_io_executor &executor, const kernel_completion &completion) {
+            auto _on_done = [_response = request.response_, _transaction_id = request.transaction_id_,
+                        _timestamp = request.timestamp_](const std::exception_ptr &exception) {
+                if (exception) {
+                    try {
+                        std::rethrow_exception(exception);
+                    } catch (const std::exception &e) {
+                        _response->mark_as_failed(_transaction_id, "internal server error", _timestamp,
+                                                  {{"exception", e.what()}});
+                    } catch (...) {
+                        _response->mark_as_failed(_transaction_id, "internal server error", _timestamp, {});
+                    }
+                }
+                _response->mark_as_processed();
+            };
+
+            // Sin ejecutor de la conexión se espera al handler como en las llamadas síncronas.
+            if (!executor) {
+                boost::asio::io_context _ioc;
+                co_spawn(_ioc, std::move(handler), _on_done);
+                _ioc.run();
+                return;
+            }
+
+            request.response_->mark_as_deferred();
+            co_spawn(executor, std::move(handler),
+                     [_on_done, _response = request.response_, completion](const std::exception_ptr &exception) {
+                         _on_done(exception);
+                         if (completion)
+                             completion(_response);
+                     });
+        }
+
+        /**
+         * Dispatch
+         *
+         * @param request
+         * @param action
+         * @param executor
+         * @param completion
+         */
+        void dispatch(const request &request, const std::string &action, const boost::asio::any_io_executor &executor,
+                      const kernel_completion &completion) {
+            if (action == "ping") {
+                handlers::ping_handler(request);
+            } else if (action == "send") {
+                handlers::send_handler(request);
+            } else if (action == "register") {
+                handlers::register_handler(request);
+            } else if (action == "session") {
+                spawn(request, handlers::session_handler(async_request::make(request)), executor, completion);
+            } else if (action == "digest") {
+                handlers::digest_handler(request);
+            } else if (action == "resync") {
+                handlers::resync_handler(request);
+            } else if (action == "load") {
+                handlers::load_handler(request);
+            } else if (action == "redirect") {
+                handlers::redirect_handler(request);
+            } else if (action == "ack") {
+                request.response_->mark_as_ack();
+            } else if (action == "subscribe") {
+                handlers::subscribe_handler(request);
+            } else if (action == "is_subscribed") {
+                handlers::is_subscribed_handler(request);
+            } else if (action == "unsubscribe") {
+                handlers::unsubscribe_handler(request);
+            } else if (action == "broadcast") {
+                handlers::broadcast_handler(request);
+            } else if (action == "publish") {
+                handlers::publish_handler(request);
+            } else if (action == "join") {
+                handlers::join_handler(request);
+            } else if (action == "leave") {
+                handlers::leave_handler(request);
+            } else if (action == "batch") {
+                handlers::batch_handler(request);
+            } else if (action == "reliable") {
+                handlers::reliable_handler(request);
+            } else if (action == "confirm") {
+                handlers::confirm_handler(request);
+            } else {
+                handlers::unimplemented_handler(request);
+            }
+        }
+
+        /**
+         * Offload
+         *
+         * Runs the action on the worker pool and posts the response back to the executor of the connection.
+         *
+         * @param request
+         * @param action
+         * @param executor
+         * @param completion
+         */
+        void offload(const request &request, const std::string &action, const boost::asio::any_io_executor &executor,
+                     const kernel_completion &completion) {
+            auto &_state = request.state_;
+            const auto _async = std::make_shared<async_request>(async_request::make(request));
+
+            const auto _submitted = _state->get_workers().submit([_async, action, executor, completion] {
+                const auto &_response = _async->response_;
+                try {
+                    dispatch(_async->to_request(), action, {}, nullptr);
+                } catch (const std::exception &e) {
+                    _response->mark_as_failed(_async->transaction_id_, "internal server error", _async->timestamp_,
+                                              {{"exception", e.what()}});
+                } catch (...) {
+                    // Nada escapa al hilo del pool, un worker muerto deja de atender la cola.
+                    _response->mark_as_failed(_async->transaction_id_, "internal server error", _async->timestamp_, {});
+                }
+                _response->mark_as_processed();
+
+                if (completion)
+                    post(executor, [completion, _response] { completion(_response); });
+            }, _state->get_config()->worker_queue_capacity_);
+
+            // Con la cola llena se rechaza en lugar de acumular trabajo.
+            if (!_submitted) {
+                request.response_->mark_as_failed(request.transaction_id_, "server busy", request.timestamp_,
+                                                  {{"workers", "queue is full"}});
+                return;
+            }
+
+            request.response_->mark_as_offloaded();
+        }
+
+        /**
+         * Get Cost
+         *
+         * Declared cost of each action, the ones missing are light.
+         *
+         * @param action
+         * @return cost
+         */
+        cost get_cost(const std::string_view action) {
+            // Un lote ejecuta hasta batch_max_requests acciones.
+            if (action == "batch")
+                return heavy;
+
+            return light;
+        }
+    }
+
     std::shared_ptr<response> kernel(const std::shared_ptr<state> &state,
                                      const boost::json::object &data,
                                      const kernel_context context,
-                                     const boost::uuids::uuid entity_id) {
+                                     const boost::uuids::uuid entity_id,
+                                     rate_limiter *limiter,
+                                     const boost::asio::any_io_executor &executor,
+                                     const kernel_completion &completion) {
         boost::ignore_unused(state);
 
         const auto _timestamp = std::chrono::system_clock::now().time_since_epoch().count();
 
         auto _response = std::make_shared<response>();
+
+        if (context == on_client && !is_allowed(state, data, limiter)) {
+            _response->mark_as_rejected(make_rate_limited_message(data));
+            _response->mark_as_processed();
+            return _response;
+        }
         if (const validator _validator(data); _validator.get_passed()) {
             const auto _request = request{
                 .transaction_id_ = get_param_as_id(data, "transaction_id"),
@@ -58,32 +314,12 @@ namespace engine {
                 .timestamp_ = _timestamp,
             };
 
-            if (const std::string _action{data.at("action").as_string()}; _action == "ping") {
-                handlers::ping_handler(_request);
-            } else if (_action == "send") {
-                handlers::send_handler(_request);
-            } else if (_action == "register") {
-                handlers::register_handler(_request);
-            } else if (_action == "session") {
-                handlers::session_handler(_request);
-            } else if (_action == "ack") {
-                _response->mark_as_ack();
-            } else if (_action == "subscribe") {
-                handlers::subscribe_handler(_request);
-            } else if (_action == "is_subscribed") {
-                handlers::is_subscribed_handler(_request);
-            } else if (_action == "unsubscribe") {
-                handlers::unsubscribe_handler(_request);
-            } else if (_action == "broadcast") {
-                handlers::broadcast_handler(_request);
-            } else if (_action == "publish") {
-                handlers::publish_handler(_request);
-            } else if (_action == "join") {
-                handlers::join_handler(_request);
-            } else if (_action == "leave") {
-                handlers::leave_handler(_request);
+            if (const std::string _action{data.at("action").as_string()};
+                context == on_client && executor && get_cost(_action) == heavy &&
+                state->get_config()->worker_threads_ > 0) {
+                offload(_request, _action, executor, completion);
             } else {
-                handlers::unimplemented_handler(_request);
+                dispatch(_request, _action, executor, completion);
             }
         } else {
             if (data.contains("transaction_id") && data.at("transaction_id").is_string() && validator::is_uuid(
@@ -96,7 +332,8 @@ namespace engine {
                                           _validator.get_bag());
             }
         }
-        _response->mark_as_processed();
+        if (!_response->is_deferred())
+            _response->mark_as_processed();
 
         return _response;
     }
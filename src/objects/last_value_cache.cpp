@@ -0,0 +1,49 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/last_value_cache.hpp>
+
+#include <mutex>
+
+namespace engine {
+    bool last_value_cache::store(const std::string &channel, std::shared_ptr<std::string const> value,
+                                 const std::size_t channels) {
+        // El camino habitual solo reemplaza el puntero, el bloqueo exclusivo se toma al crear el canal.
+        if (const auto _slot = find(channel); _slot != nullptr) {
+            _slot->store(std::move(value), std::memory_order_release);
+            return true;
+        }
+
+        std::unique_lock _lock(slots_mutex_);
+        if (const auto _it = slots_.find(channel); _it != slots_.end()) {
+            _it->second->store(std::move(value), std::memory_order_release);
+            return true;
+        }
+
+        if (slots_.size() >= channels)
+            return false;
+
+        slots_.emplace(channel, std::make_unique<slot>(std::move(value)));
+        return true;
+    }
+
+    std::shared_ptr<std::string const> last_value_cache::load(const std::string &channel) const {
+        if (const auto _slot = find(channel); _slot != nullptr)
+            return _slot->load(std::memory_order_acquire);
+
+        return nullptr;
+    }
+
+    std::size_t last_value_cache::get_size() const {
+        std::shared_lock _lock(slots_mutex_);
+        return slots_.size();
+    }
+
+    last_value_cache::slot *last_value_cache::find(const std::string &channel) const {
+        std::shared_lock _lock(slots_mutex_);
+        if (const auto _it = slots_.find(channel); _it != slots_.end())
+            return _it->second.get();
+
+        return nullptr;
+    }
+} // namespace engine
@@ -0,0 +1,28 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/latency_meter.hpp>
+
+#include <algorithm>
+
+namespace engine {
+    void latency_meter::record(const std::chrono::steady_clock::duration duration) {
+        const auto _duration = static_cast<std::uint64_t>(
+            std::max<std::int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), 0));
+
+        count_.fetch_add(1, std::memory_order_relaxed);
+        total_.fetch_add(_duration, std::memory_order_relaxed);
+
+        auto _max = max_.load(std::memory_order_relaxed);
+        while (_duration > _max && !max_.compare_exchange_weak(_max, _duration, std::memory_order_relaxed)) {
+        }
+    }
+
+    queue_latency latency_meter::get() const {
+        return {
+            .count_ = count_.load(std::memory_order_relaxed),
+            .total_ = total_.load(std::memory_order_relaxed),
+            .max_ = max_.load(std::memory_order_relaxed),
+        };
+    }
+} // namespace engine
@@ -0,0 +1,119 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/local_client_listener.hpp>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
+
+#include <engine/logger.hpp>
+#include <engine/client.hpp>
+#include <engine/state.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace engine {
+    local_client_listener::local_client_listener(boost::asio::io_context &ioc, const std::string &path,
+                                                 const std::shared_ptr<state> &state) : ioc_(ioc),
+        acceptor_(make_strand(ioc)), state_(state), path_(path) {
+        boost::beast::error_code ec;
+
+        // Un socket huérfano de una ejecución previa impide el bind.
+        ::unlink(path_.c_str());
+
+        const boost::asio::local::stream_protocol::endpoint _endpoint{path_};
+
+        acceptor_.open(_endpoint.protocol(), ec);
+        if (ec) {
+            LOG_INFO("local listener failed on open: {}", ec.message());
+            return;
+        }
+
+        acceptor_.bind(_endpoint, ec);
+        if (ec) {
+            LOG_INFO("local listener failed on bind: {}", ec.message());
+            return;
+        }
+
+        if (::chmod(path_.c_str(), S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP) != 0) {
+            LOG_INFO("local listener failed on chmod: {}", path_);
+            acceptor_.close(ec);
+            return;
+        }
+
+        acceptor_.listen(boost::asio::socket_base::max_listen_connections, ec);
+        if (ec) {
+            LOG_INFO("local listener failed on listen: {}", ec.message());
+            return;
+        }
+
+        LOG_INFO("state_id=[{}] local clients is listening on [{}]", to_string(state_->get_id()), path_);
+    }
+
+    local_client_listener::~local_client_listener() {
+        if (acceptor_.is_open())
+            ::unlink(path_.c_str());
+    }
+
+    void local_client_listener::on_accept(const boost::beast::error_code &ec,
+                                          boost::asio::local::stream_protocol::socket socket) {
+        if (ec) {
+            LOG_INFO("local listener failed on accept: {}", ec.message());
+        } else if (!is_trusted(socket)) {
+            LOG_INFO("state_id=[{}] action=[local_client_rejected]", to_string(state_->get_id()));
+            boost::system::error_code _ec;
+            socket.close(_ec);
+        } else {
+            const auto _client = std::make_shared<client>(state_->get_id(), state_);
+            _client->set_local_socket(std::move(socket));
+            _client->run();
+        }
+
+        if (acceptor_.is_open())
+            do_accept();
+    }
+
+    void local_client_listener::do_accept() {
+        acceptor_.async_accept(
+            make_strand(ioc_),
+            boost::beast::bind_front_handler(
+                &local_client_listener::on_accept,
+                shared_from_this()));
+    }
+
+    void local_client_listener::start() {
+        if (acceptor_.is_open())
+            do_accept();
+    }
+
+    void local_client_listener::stop() {
+        post(acceptor_.get_executor(), [_listener = shared_from_this()] {
+            if (!_listener->acceptor_.is_open())
+                return;
+
+            ::unlink(_listener->path_.c_str());
+
+            boost::system::error_code _ec;
+            _listener->acceptor_.close(_ec);
+        });
+    }
+
+    bool local_client_listener::is_trusted(boost::asio::local::stream_protocol::socket &socket) {
+#ifdef SO_PEERCRED
+        ucred _credentials{};
+        socklen_t _length = sizeof(_credentials);
+
+        if (::getsockopt(socket.native_handle(), SOL_SOCKET, SO_PEERCRED, &_credentials, &_length) != 0)
+            return false;
+
+        // Sólo procesos del mismo usuario efectivo o root.
+        return _credentials.uid == 0 || _credentials.uid == ::geteuid();
+#else
+        boost::ignore_unused(socket);
+        return true;
+#endif
+    }
+} // namespace engine
@@ -0,0 +1,77 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/outbound_queue.hpp>
+
+namespace engine {
+    outbound_queue::outbound_queue(const std::size_t weight) : weight_(weight) {
+    }
+
+    bool outbound_queue::push(std::shared_ptr<std::string const> data, const priority priority,
+                              const std::chrono::steady_clock::time_point now, const std::string_view key) {
+        auto &_items = items_[priority];
+
+        if (!key.empty() && priority == bulk)
+            keys_.insert_or_assign(std::string(key), bulk_front_ + _items.size());
+
+        _items.push_back(item{
+            .data_ = std::move(data),
+            .priority_ = priority,
+            .queued_at_ = now,
+            .key_ = priority == bulk ? std::string(key) : std::string(),
+        });
+
+        return !current_.has_value();
+    }
+
+    bool outbound_queue::replace(const std::string_view key, std::shared_ptr<std::string const> data) {
+        const auto _it = keys_.find(key);
+        if (_it == keys_.end())
+            return false;
+
+        items_[bulk][_it->second - bulk_front_].data_ = std::move(data);
+        return true;
+    }
+
+    const outbound_queue::item *outbound_queue::next() {
+        auto &_control = items_[control];
+        auto &_bulk = items_[bulk];
+
+        if (_control.empty() && _bulk.empty())
+            return nullptr;
+
+        // Con datos en espera se cede un turno cada weight mensajes de control.
+        const bool _take_bulk = _control.empty() || (!_bulk.empty() && weight_ > 0 && streak_ >= weight_);
+
+        auto &_items = _take_bulk ? _bulk : _control;
+        current_.emplace(std::move(_items.front()));
+        _items.pop_front();
+
+        if (_take_bulk) {
+            // Una vez en vuelo el mensaje ya no puede reemplazarse.
+            if (!current_->key_.empty()) {
+                if (const auto _it = keys_.find(current_->key_); _it != keys_.end() && _it->second == bulk_front_)
+                    keys_.erase(_it);
+            }
+
+            ++bulk_front_;
+            streak_ = 0;
+        } else if (!_bulk.empty()) {
+            ++streak_;
+        }
+
+        return &current_.value();
+    }
+
+    void outbound_queue::complete() {
+        current_.reset();
+    }
+
+    bool outbound_queue::empty() const {
+        return items_[control].empty() && items_[bulk].empty();
+    }
+
+    std::size_t outbound_queue::size() const {
+        return items_[control].size() + items_[bulk].size() + (current_.has_value() ? 1 : 0);
+    }
+} // namespace engine
@@ -0,0 +1,401 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/publish_log.hpp>
+
+#include <engine/logger.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace engine {
+    namespace {
+        /**
+         * Header Size
+         *
+         * Size, checksum, sequence and timestamp of a record.
+         */
+        constexpr std::size_t header_size = 24;
+
+        /**
+         * Index Interval
+         *
+         * Bytes between two entries of the sparse index.
+         */
+        constexpr std::size_t index_interval = 4096;
+
+        /**
+         * Get Length
+         *
+         * @param size
+         * @return size_t Bytes taken by a record, aligned to 8
+         */
+        constexpr std::size_t get_length(const std::size_t size) {
+            return (header_size + size + 7) & ~static_cast<std::size_t>(7);
+        }
+
+        /**
+         * Get Checksum
+         *
+         * @param sequence
+         * @param timestamp
+         * @param data
+         * @return uint32_t FNV-1a of the record
+         */
+        std::uint32_t get_checksum(const std::uint64_t sequence, const std::int64_t timestamp,
+                                   const std::string_view data) {
+            std::uint32_t _hash = 2166136261u;
+            const auto _mix = [&_hash](const char *bytes, const std::size_t size) {
+                for (std::size_t _i = 0; _i < size; ++_i) {
+                    _hash ^= static_cast<unsigned char>(bytes[_i]);
+                    _hash *= 16777619u;
+                }
+            };
+
+            _mix(reinterpret_cast<const char *>(&sequence), sizeof(sequence));
+            _mix(reinterpret_cast<const char *>(&timestamp), sizeof(timestamp));
+            _mix(data.data(), data.size());
+            return _hash;
+        }
+
+        /**
+         * Read Header
+         *
+         * @param data
+         * @param available Bytes left in the segment from data
+         * @param record
+         * @return size_t Length of a valid record, 0 at the end of the segment or on a torn record
+         */
+        std::size_t read_header(const char *data, const std::size_t available, publish_log::record &record) {
+            if (available < header_size)
+                return 0;
+
+            std::uint32_t _size;
+            std::uint32_t _checksum;
+            std::memcpy(&_size, data, sizeof(_size));
+            std::memcpy(&_checksum, data + 4, sizeof(_checksum));
+            std::memcpy(&record.sequence_, data + 8, sizeof(record.sequence_));
+            std::memcpy(&record.timestamp_, data + 16, sizeof(record.timestamp_));
+
+            if (_size == 0 || get_length(_size) > available)
+                return 0;
+
+            record.data_ = std::string_view(data + header_size, _size);
+            if (get_checksum(record.sequence_, record.timestamp_, record.data_) != _checksum)
+                return 0;
+
+            return get_length(_size);
+        }
+    }
+
+    publish_log::publish_log(std::filesystem::path directory, const std::size_t segment_bytes,
+                             const std::size_t segments, const fsync_policy policy)
+        : directory_(std::move(directory)), segment_bytes_(segment_bytes), segments_limit_(std::max<std::size_t>(
+              segments, 1)), policy_(policy) {
+        std::error_code _ec;
+        std::filesystem::create_directories(directory_, _ec);
+
+        std::vector<std::filesystem::path> _paths;
+        for (const auto &_entry: std::filesystem::directory_iterator(directory_, _ec)) {
+            if (_entry.is_regular_file() && _entry.path().extension() == ".log")
+                _paths.push_back(_entry.path());
+        }
+
+        // El nombre es la primera secuencia con ceros a la izquierda, el orden léxico es el del log.
+        std::ranges::sort(_paths);
+        for (const auto &_path: _paths)
+            recover(_path);
+
+        while (segments_.size() > segments_limit_) {
+            close_segment(segments_.front());
+            std::filesystem::remove(segments_.front().path_, _ec);
+            segments_.pop_front();
+        }
+    }
+
+    publish_log::~publish_log() {
+        for (auto &_segment: segments_) {
+            if (policy_ != fsync_never)
+                sync_segment(_segment);
+
+            close_segment(_segment);
+        }
+    }
+
+    std::uint64_t publish_log::get_next_sequence() const {
+        std::scoped_lock _lock(mutex_);
+        return next_sequence_;
+    }
+
+    bool publish_log::append(const std::uint64_t sequence, const std::int64_t timestamp, const std::string_view data) {
+        if (data.empty() || data.size() > std::numeric_limits<std::uint32_t>::max())
+            return false;
+
+        const auto _length = get_length(data.size());
+        if (_length > segment_bytes_)
+            return false;
+
+        std::scoped_lock _lock(mutex_);
+
+        if (segments_.empty() || segments_.back().capacity_ - segments_.back().size_ < _length) {
+            if (!segments_.empty() && policy_ != fsync_never)
+                sync_segment(segments_.back());
+
+            if (!open_segment(sequence))
+                return false;
+
+            while (segments_.size() > segments_limit_) {
+                std::error_code _ec;
+                close_segment(segments_.front());
+                std::filesystem::remove(segments_.front().path_, _ec);
+                segments_.pop_front();
+            }
+        }
+
+        auto &_segment = segments_.back();
+        const auto _offset = _segment.size_;
+        char *_at = _segment.data_ + _offset;
+
+        // El tamaño se escribe al final, un registro a medias no se reconoce al recuperar.
+        const auto _size = static_cast<std::uint32_t>(data.size());
+        const auto _checksum = get_checksum(sequence, timestamp, data);
+        std::memcpy(_at + header_size, data.data(), data.size());
+        std::memcpy(_at + 4, &_checksum, sizeof(_checksum));
+        std::memcpy(_at + 8, &sequence, sizeof(sequence));
+        std::memcpy(_at + 16, &timestamp, sizeof(timestamp));
+        std::memcpy(_at, &_size, sizeof(_size));
+
+        index_record(_segment, sequence, timestamp, _offset);
+        _segment.size_ += _length;
+        _segment.next_sequence_ = sequence + 1;
+        next_sequence_ = sequence + 1;
+
+        if (policy_ == fsync_always)
+            sync_segment(_segment);
+
+        return true;
+    }
+
+    std::mutex &publish_log::get_mutex() {
+        return publish_mutex_;
+    }
+
+    void publish_log::sync() {
+        std::scoped_lock _lock(mutex_);
+        for (auto &_segment: segments_)
+            sync_segment(_segment);
+    }
+
+    std::size_t publish_log::read_since_sequence(const std::uint64_t sequence, const visitor &visitor,
+                                                 const std::size_t limit) const {
+        std::scoped_lock _lock(mutex_);
+
+        for (std::size_t _position = 0; _position < segments_.size(); ++_position) {
+            const auto &_segment = segments_[_position];
+            if (_segment.index_.empty() || _segment.next_sequence_ <= sequence + 1)
+                continue;
+
+            // Último punto del índice que no supera la secuencia pedida.
+            const auto _it = std::ranges::upper_bound(_segment.index_, sequence, {}, &index_entry::sequence_);
+            const auto _offset = _it == _segment.index_.begin() ? 0 : std::prev(_it)->offset_;
+
+            return read_from(_position, _offset,
+                             [sequence](const record &record) { return record.sequence_ > sequence; }, visitor, limit);
+        }
+
+        return 0;
+    }
+
+    std::size_t publish_log::read_since_timestamp(const std::int64_t timestamp, const visitor &visitor,
+                                                  const std::size_t limit) const {
+        std::scoped_lock _lock(mutex_);
+
+        for (std::size_t _position = 0; _position < segments_.size(); ++_position) {
+            const auto &_segment = segments_[_position];
+            if (_segment.index_.empty())
+                continue;
+
+            if (_position + 1 < segments_.size() && !segments_[_position + 1].index_.empty() &&
+                segments_[_position + 1].index_.front().timestamp_ < timestamp)
+                continue;
+
+            const auto _it = std::ranges::lower_bound(_segment.index_, timestamp, {}, &index_entry::timestamp_);
+            const auto _offset = _it == _segment.index_.begin() ? 0 : std::prev(_it)->offset_;
+
+            return read_from(_position, _offset,
+                             [timestamp](const record &record) { return record.timestamp_ >= timestamp; }, visitor,
+                             limit);
+        }
+
+        return 0;
+    }
+
+    std::size_t publish_log::get_segments_count() const {
+        std::scoped_lock _lock(mutex_);
+        return segments_.size();
+    }
+
+    std::size_t publish_log::get_bytes() const {
+        std::scoped_lock _lock(mutex_);
+
+        std::size_t _bytes = 0;
+        for (const auto &_segment: segments_)
+            _bytes += _segment.size_;
+
+        return _bytes;
+    }
+
+    void publish_log::recover(const std::filesystem::path &path) {
+        const int _fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+        if (_fd < 0)
+            return;
+
+        struct stat _stat{};
+        if (::fstat(_fd, &_stat) != 0 || static_cast<std::size_t>(_stat.st_size) < header_size) {
+            ::close(_fd);
+            return;
+        }
+
+        const auto _capacity = static_cast<std::size_t>(_stat.st_size);
+        void *_data = ::mmap(nullptr, _capacity, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+        if (_data == MAP_FAILED) {
+            ::close(_fd);
+            return;
+        }
+
+        segment _segment{
+            .path_ = path,
+            .fd_ = _fd,
+            .data_ = static_cast<char *>(_data),
+            .capacity_ = _capacity,
+        };
+
+        record _record;
+        std::size_t _offset = 0;
+        while (const auto _length = read_header(_segment.data_ + _offset, _capacity - _offset, _record)) {
+            index_record(_segment, _record.sequence_, _record.timestamp_, _offset);
+            _segment.next_sequence_ = _record.sequence_ + 1;
+            _offset += _length;
+        }
+
+        // Lo que sigue a un registro roto se limpia para que las próximas escrituras no lo revivan.
+        if (_offset + 4 <= _capacity) {
+            std::uint32_t _size;
+            std::memcpy(&_size, _segment.data_ + _offset, sizeof(_size));
+            if (_size != 0) {
+                LOG_INFO("action=[publish_log] path=[{}] offset=[{}] status=[torn]", path.string(), _offset);
+                std::memset(_segment.data_ + _offset, 0, _capacity - _offset);
+            }
+        }
+
+        _segment.size_ = _offset;
+        _segment.synced_ = _offset;
+        next_sequence_ = std::max(next_sequence_, _segment.next_sequence_);
+        segments_.push_back(std::move(_segment));
+    }
+
+    bool publish_log::open_segment(const std::uint64_t first_sequence) {
+        auto _path = directory_ / fmt::format("{:020}.log", first_sequence);
+
+        const int _fd = ::open(_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (_fd < 0)
+            return false;
+
+        if (::ftruncate(_fd, static_cast<off_t>(segment_bytes_)) != 0) {
+            ::close(_fd);
+            return false;
+        }
+
+        void *_data = ::mmap(nullptr, segment_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+        if (_data == MAP_FAILED) {
+            ::close(_fd);
+            return false;
+        }
+
+        segments_.push_back(segment{
+            .path_ = std::move(_path),
+            .fd_ = _fd,
+            .data_ = static_cast<char *>(_data),
+            .capacity_ = segment_bytes_,
+        });
+
+        return true;
+    }
+
+    void publish_log::close_segment(segment &segment) {
+        if (segment.data_ != nullptr)
+            ::munmap(segment.data_, segment.capacity_);
+
+        if (segment.fd_ >= 0)
+            ::close(segment.fd_);
+
+        segment.data_ = nullptr;
+        segment.fd_ = -1;
+    }
+
+    void publish_log::sync_segment(segment &segment) {
+        if (segment.data_ == nullptr || segment.synced_ >= segment.size_)
+            return;
+
+        // msync exige una dirección alineada a página.
+        static const auto _page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const auto _from = segment.synced_ / _page * _page;
+
+        ::msync(segment.data_ + _from, segment.size_ - _from, MS_SYNC);
+        segment.synced_ = segment.size_;
+    }
+
+    void publish_log::index_record(segment &segment, const std::uint64_t sequence, const std::int64_t timestamp,
+                                   const std::size_t offset) {
+        if (!segment.index_.empty() && offset - segment.indexed_at_ < index_interval)
+            return;
+
+        segment.index_.push_back(index_entry{
+            .sequence_ = sequence,
+            .timestamp_ = timestamp,
+            .offset_ = offset,
+        });
+        segment.indexed_at_ = offset;
+    }
+
+    std::size_t publish_log::read_from(const std::size_t position, std::size_t offset,
+                                       const std::function<bool(const record &)> &accept,
+                                       const visitor &visitor, const std::size_t limit) const {
+        std::size_t _count = 0;
+        std::size_t _bytes = 0;
+        bool _accepted = false;
+
+        record _record;
+        for (auto _position = position; _position < segments_.size(); ++_position, offset = 0) {
+            const auto &_segment = segments_[_position];
+            while (offset < _segment.size_) {
+                const auto _length = read_header(_segment.data_ + offset, _segment.size_ - offset, _record);
+                if (_length == 0)
+                    break;
+
+                offset += _length;
+                _accepted = _accepted || accept(_record);
+                if (!_accepted)
+                    continue;
+
+                // El límite corta la lectura entre registros, nunca deja uno a medias.
+                if (_count > 0 && _record.data_.size() > limit - std::min(_bytes, limit))
+                    return _count;
+
+                visitor(_record);
+                _bytes += _record.data_.size();
+                ++_count;
+            }
+        }
+
+        return _count;
+    }
+} // namespace engine
@@ -0,0 +1,26 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/rate_limiter.hpp>
+
+#include <engine/config.hpp>
+
+namespace engine {
+    rate_limiter::rate_limiter(const config &config) : client_(config.client_rate_limit_, config.rate_limit_burst_),
+                                                       fanout_(config.fanout_rate_limit_, config.rate_limit_burst_) {
+    }
+
+    bool rate_limiter::is_enabled() const {
+        return client_.is_enabled() || fanout_.is_enabled();
+    }
+
+    bool rate_limiter::consume(const std::string_view action, const std::int64_t now) {
+        if (fanout_.is_enabled() && (action == "broadcast" || action == "publish" || action == "send")) {
+            // Se verifica primero el balde más restrictivo para no consumir del cliente al rechazar.
+            if (!fanout_.consume(now))
+                return false;
+        }
+
+        return client_.consume(now);
+    }
+} // namespace engine
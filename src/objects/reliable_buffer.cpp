@@ -0,0 +1,134 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/reliable_buffer.hpp>
+
+#include <fmt/format.h>
+
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <stdexcept>
+
+namespace engine {
+    reliable_buffer::reliable_buffer(const std::size_t messages, const std::size_t bytes)
+        : messages_(std::max<std::size_t>(messages, 1)), bytes_limit_(bytes) {
+        // El client_id viaja en cada envelope, retomar exige un secreto que sólo conoce la conexión original.
+        std::array<unsigned char, 32> _random{};
+        if (RAND_bytes(_random.data(), static_cast<int>(_random.size())) != 1)
+            throw std::runtime_error("unable to generate reliable token");
+
+        token_.reserve(_random.size() * 2);
+        for (const auto _byte: _random)
+            fmt::format_to(std::back_inserter(token_), "{:02x}", _byte);
+    }
+
+    std::shared_ptr<std::string const> reliable_buffer::push(const std::shared_ptr<std::string const> &data) {
+        std::scoped_lock _lock(mutex_);
+
+        const auto _sequence = next_sequence_++;
+
+        // El sobre ya serializado se envuelve sin volver a interpretarlo.
+        auto _framed = std::make_shared<std::string const>(
+            fmt::format(R"({{"action":"deliver","sequence":{},"data":{}}})", _sequence, *data));
+
+        while (!entries_.empty() && (entries_.size() >= messages_ || bytes_ + _framed->size() > bytes_limit_)) {
+            pop();
+            ++dropped_;
+        }
+
+        bytes_ += _framed->size();
+        entries_.push_back(entry{.sequence_ = _sequence, .data_ = _framed});
+        return _framed;
+    }
+
+    std::size_t reliable_buffer::confirm(const std::uint64_t sequence) {
+        std::scoped_lock _lock(mutex_);
+
+        std::size_t _released = 0;
+        while (!entries_.empty() && entries_.front().sequence_ <= sequence) {
+            pop();
+            ++_released;
+        }
+
+        return _released;
+    }
+
+    std::vector<std::shared_ptr<std::string const> > reliable_buffer::get_unconfirmed() const {
+        std::scoped_lock _lock(mutex_);
+
+        std::vector<std::shared_ptr<std::string const> > _result;
+        _result.reserve(entries_.size());
+
+        for (const auto &_entry: entries_)
+            _result.push_back(_entry.data_);
+
+        return _result;
+    }
+
+    std::uint64_t reliable_buffer::get_next_sequence() const {
+        std::scoped_lock _lock(mutex_);
+        return next_sequence_;
+    }
+
+    std::uint64_t reliable_buffer::get_first_sequence() const {
+        std::scoped_lock _lock(mutex_);
+        return entries_.empty() ? next_sequence_ : entries_.front().sequence_;
+    }
+
+    std::size_t reliable_buffer::get_size() const {
+        std::scoped_lock _lock(mutex_);
+        return entries_.size();
+    }
+
+    std::size_t reliable_buffer::get_bytes() const {
+        std::scoped_lock _lock(mutex_);
+        return bytes_;
+    }
+
+    std::uint64_t reliable_buffer::get_dropped() const {
+        std::scoped_lock _lock(mutex_);
+        return dropped_;
+    }
+
+    void reliable_buffer::release(const std::chrono::steady_clock::time_point now) {
+        std::scoped_lock _lock(mutex_);
+        released_at_ = now;
+    }
+
+    bool reliable_buffer::adopt() {
+        std::scoped_lock _lock(mutex_);
+        if (!released_at_.has_value())
+            return false;
+
+        released_at_.reset();
+        return true;
+    }
+
+    bool reliable_buffer::is_expired(const std::chrono::steady_clock::time_point now,
+                                     const std::chrono::steady_clock::duration retention) const {
+        std::scoped_lock _lock(mutex_);
+        return released_at_.has_value() && released_at_.value() + retention < now;
+    }
+
+    std::optional<std::chrono::steady_clock::time_point> reliable_buffer::get_released_at() const {
+        std::scoped_lock _lock(mutex_);
+        return released_at_;
+    }
+
+    const std::string &reliable_buffer::get_token() const {
+        return token_;
+    }
+
+    bool reliable_buffer::is_token(const std::string_view token) const {
+        return token.size() == token_.size() && CRYPTO_memcmp(token.data(), token_.data(), token_.size()) == 0;
+    }
+
+    void reliable_buffer::pop() {
+        bytes_ -= entries_.front().data_->size();
+        entries_.pop_front();
+    }
+} // namespace engine
@@ -18,10 +18,11 @@
 #include <iostream>
 
 namespace engine {
-    repl::repl(const std::shared_ptr<state> &state)
+    repl::repl(const std::shared_ptr<state> &state, std::function<void()> on_drain)
         : input_(state->get_ioc(), ::dup(STDIN_FILENO)),
           output_(state->get_ioc(), ::dup(STDOUT_FILENO)),
-          state_(state) {
+          state_(state),
+          on_drain_(std::move(on_drain)) {
         start();
     }
 
@@ -46,7 +47,27 @@ namespace engine {
 
                 for (auto & _session : _sessions) {
                     fmt::print("id #{}\n", to_string(_session->get_id()));
-                    fmt::print("sessions_port={} clients_port={}\n\n", _session->get_sessions_port(), _session->get_clients_port());
+                    fmt::print("sessions_port={} clients_port={}\n", _session->get_sessions_port(), _session->get_clients_port());
+                    fmt::print("rtt_us={} jitter_us={} healthy={} lanes={}\n\n", _session->get_rtt(), _session->get_jitter(), _session->is_healthy(), _session->get_lanes_count());
+
+                    if (const auto _load = _session->get_load(); _load.has_value())
+                        fmt::print("load clients={} rate={:.2f} queued={}\n\n", _load->clients_, _load->rate_, _load->queued_);
+                }
+                fmt::print("============\n");
+
+                fmt::print("dedup hits={} misses={}\n", state_->get_dedup_hits(), state_->get_dedup_misses());
+
+                for (const auto [_name, _priority] : {std::pair{"control", control}, std::pair{"bulk", bulk}}) {
+                    const auto _latency = state_->get_queue_latency(_priority);
+                    fmt::print("queue {} count={} avg_us={} max_us={}\n", _name, _latency.count_,
+                               _latency.count_ > 0 ? _latency.total_ / _latency.count_ : 0, _latency.max_);
+                }
+
+                auto &_workers = state_->get_workers();
+                fmt::print("workers pending={} rejected={}\n", _workers.get_pending(), _workers.get_rejected());
+                for (const auto [_name, _latency] : {std::pair{"queue", _workers.get_queue_time()}, std::pair{"run", _workers.get_run_time()}}) {
+                    fmt::print("workers {} count={} avg_us={} max_us={}\n", _name, _latency.count_,
+                               _latency.count_ > 0 ? _latency.total_ / _latency.count_ : 0, _latency.max_);
                 }
                 fmt::print("============\n");
 
@@ -71,6 +92,11 @@ namespace engine {
                 fmt::print("============\n");
             }
 
+            if (_line == "drain" && on_drain_) {
+                fmt::print("draining {} clients\n", state_->get_load().clients_);
+                on_drain_();
+            }
+
             if (_line == "exit") {
                 return;
             }
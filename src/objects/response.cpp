@@ -5,6 +5,7 @@
 #include <map>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <boost/json/serialize.hpp>
 
 namespace engine {
     bool response::get_failed() const {
@@ -23,6 +24,23 @@ namespace engine {
         is_ack_.store(true, std::memory_order_release);
     }
 
+    bool response::is_deferred() const {
+        return is_deferred_.load(std::memory_order_acquire);
+    }
+
+    void response::mark_as_deferred() {
+        is_deferred_.store(true, std::memory_order_release);
+    }
+
+    bool response::is_offloaded() const {
+        return is_offloaded_.load(std::memory_order_acquire);
+    }
+
+    void response::mark_as_offloaded() {
+        is_offloaded_.store(true, std::memory_order_release);
+        is_deferred_.store(true, std::memory_order_release);
+    }
+
     boost::json::object response::get_data() const { return data_; }
 
     void response::mark_as_failed(const boost::uuids::uuid transaction_id, const char *error, long timestamp,
@@ -61,6 +79,18 @@ namespace engine {
         }
     }
 
+    void response::mark_as_rejected(const std::shared_ptr<std::string const> &message) {
+        failed_.store(true, std::memory_order_release);
+        message_ = message;
+    }
+
+    std::shared_ptr<std::string const> response::get_message() const {
+        if (message_)
+            return message_;
+
+        return std::make_shared<std::string const>(serialize(data_));
+    }
+
     void response::mark_as_processed() {
         processed_.store(true, std::memory_order_release);
     }
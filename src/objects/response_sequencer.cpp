@@ -0,0 +1,34 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/response_sequencer.hpp>
+
+namespace engine {
+    std::uint64_t response_sequencer::reserve() {
+        slots_.emplace_back(std::nullopt);
+        return front_ + slots_.size() - 1;
+    }
+
+    std::vector<std::shared_ptr<std::string const> > response_sequencer::complete(
+        const std::uint64_t slot, std::shared_ptr<std::string const> message) {
+        std::vector<std::shared_ptr<std::string const> > _ready;
+        if (slot < front_ || slot - front_ >= slots_.size())
+            return _ready;
+
+        slots_[slot - front_] = std::move(message);
+
+        while (!slots_.empty() && slots_.front().has_value()) {
+            if (auto &_message = slots_.front().value(); _message != nullptr)
+                _ready.push_back(std::move(_message));
+
+            slots_.pop_front();
+            ++front_;
+        }
+
+        return _ready;
+    }
+
+    std::size_t response_sequencer::get_pending() const {
+        return slots_.size();
+    }
+} // namespace engine
@@ -11,13 +11,77 @@
 
 #include <engine/session_listener.hpp>
 #include <engine/client_listener.hpp>
+#include <engine/local_client_listener.hpp>
 #include <engine/repl.hpp>
 #include <boost/asio/strand.hpp>
+#include <boost/asio/executor_work_guard.hpp>
 
 namespace engine {
     server::server(const std::shared_ptr<config> &configuration) : state_(std::make_shared<state>(configuration)) {
     }
 
+    boost::program_options::options_description server::get_options() {
+        boost::program_options::options_description _options("Options");
+        auto _push_option = _options.add_options();
+
+        _push_option("address", boost::program_options::value<std::string>()->default_value("0.0.0.0"));
+        _push_option("threads", boost::program_options::value<unsigned short>()->default_value(4));
+        _push_option("handshake_threads", boost::program_options::value<unsigned short>()->default_value(0));
+        _push_option("session_lanes", boost::program_options::value<unsigned short>()->default_value(1));
+        _push_option("topology", boost::program_options::value<std::string>()->default_value("mesh"));
+        _push_option("relay_max_hops", boost::program_options::value<unsigned short>()->default_value(16));
+        _push_option("session_batch_messages", boost::program_options::value<std::size_t>()->default_value(1));
+        _push_option("session_batch_bytes", boost::program_options::value<std::size_t>()->default_value(65536));
+        _push_option("session_batch_delay", boost::program_options::value<std::size_t>()->default_value(200));
+        _push_option("peer_retention", boost::program_options::value<unsigned short>()->default_value(30));
+        _push_option("session_heartbeat_interval", boost::program_options::value<std::size_t>()->default_value(1000));
+        _push_option("session_heartbeat_misses", boost::program_options::value<unsigned short>()->default_value(3));
+        _push_option("load_report_interval", boost::program_options::value<std::size_t>()->default_value(1000));
+        _push_option("load_threshold", boost::program_options::value<std::size_t>()->default_value(0));
+        _push_option("drain_deadline", boost::program_options::value<std::size_t>()->default_value(10000));
+        _push_option("dedup_ttl", boost::program_options::value<std::size_t>()->default_value(0));
+        _push_option("dedup_capacity", boost::program_options::value<std::size_t>()->default_value(65536));
+        _push_option("history_messages", boost::program_options::value<std::size_t>()->default_value(0));
+        _push_option("history_bytes", boost::program_options::value<std::size_t>()->default_value(1048576));
+        _push_option("history_age", boost::program_options::value<std::size_t>()->default_value(60000));
+        _push_option("last_value_channels", boost::program_options::value<std::size_t>()->default_value(0));
+        _push_option("client_rate_limit", boost::program_options::value<std::size_t>()->default_value(0));
+        _push_option("fanout_rate_limit", boost::program_options::value<std::size_t>()->default_value(0));
+        _push_option("channel_rate_limit", boost::program_options::value<std::size_t>()->default_value(0));
+        _push_option("rate_limit_burst", boost::program_options::value<std::size_t>()->default_value(20));
+        _push_option("queue_control_weight", boost::program_options::value<std::size_t>()->default_value(4));
+        _push_option("conflated_channels", boost::program_options::value<std::string>()->default_value(""));
+        _push_option("batch_max_requests", boost::program_options::value<std::size_t>()->default_value(1000));
+        _push_option("worker_threads", boost::program_options::value<unsigned short>()->default_value(0));
+        _push_option("worker_queue_capacity", boost::program_options::value<std::size_t>()->default_value(1024));
+        _push_option("publish_log_path", boost::program_options::value<std::string>()->default_value(""));
+        _push_option("publish_log_segment_bytes", boost::program_options::value<std::size_t>()->default_value(16777216));
+        _push_option("publish_log_segments", boost::program_options::value<std::size_t>()->default_value(4));
+        _push_option("publish_log_fsync", boost::program_options::value<std::string>()->default_value("interval"));
+        _push_option("publish_log_fsync_interval", boost::program_options::value<std::size_t>()->default_value(100));
+        _push_option("publish_log_replay_bytes", boost::program_options::value<std::size_t>()->default_value(1048576));
+        _push_option("snapshot_path", boost::program_options::value<std::string>()->default_value(""));
+        _push_option("snapshot_interval", boost::program_options::value<std::size_t>()->default_value(5000));
+        _push_option("reliable_messages", boost::program_options::value<std::size_t>()->default_value(1024));
+        _push_option("reliable_bytes", boost::program_options::value<std::size_t>()->default_value(1048576));
+        _push_option("reliable_retention", boost::program_options::value<unsigned short>()->default_value(60));
+        _push_option("reliable_orphans", boost::program_options::value<std::size_t>()->default_value(1024));
+        _push_option("is_node", boost::program_options::value<bool>()->default_value(false));
+        _push_option("sessions_port", boost::program_options::value<unsigned short>()->default_value(11000));
+        _push_option("clients_port", boost::program_options::value<unsigned short>()->default_value(12000));
+        _push_option("clients_socket_path", boost::program_options::value<std::string>()->default_value(""));
+        _push_option("remote_address", boost::program_options::value<std::string>()->default_value("localhost"));
+        _push_option("remote_sessions_port", boost::program_options::value<unsigned short>()->default_value(9000));
+        _push_option("remote_clients_port", boost::program_options::value<unsigned short>()->default_value(10000));
+        _push_option("ssl_client_listener_password", boost::program_options::value<std::string>()->default_value("36e422f3"));
+        _push_option("ssl_session_listener_password", boost::program_options::value<std::string>()->default_value("610191e8"));
+        _push_option("ssl_session_password", boost::program_options::value<std::string>()->default_value("5ec35a12"));
+        _push_option("ssl_client_password", boost::program_options::value<std::string>()->default_value("d96ab300"));
+        _push_option("ssl_ktls", boost::program_options::value<bool>()->default_value(false));
+
+        return _options;
+    }
+
     void server::start_session_listener() {
         const auto &_config = state_->get_config();
         auto const _address = boost::asio::ip::make_address(_config->address_);
@@ -44,6 +108,15 @@ namespace engine {
         client_listener_->start();
     }
 
+    void server::start_local_client_listener() {
+        const auto &_config = state_->get_config();
+
+        local_client_listener_ = std::make_shared<local_client_listener>(state_->get_ioc(),
+                                                                         _config->clients_socket_path_, state_);
+
+        local_client_listener_->start();
+    }
+
     void server::connect_to_remote() {
         auto const &_config = state_->get_config();
 
@@ -73,7 +146,25 @@ namespace engine {
 
     void server::run_in_threads() {
         auto const &_config = state_->get_config();
-        vector_of_threads_.reserve(_config->threads_ - 1);
+        vector_of_threads_.reserve(_config->threads_ + _config->handshake_threads_ + _config->worker_threads_);
+        for (auto i = _config->handshake_threads_; i > 0; --i)
+            vector_of_threads_.emplace_back(
+                [_state = this->state_->shared_from_this()]() {
+                    auto _guard = boost::asio::make_work_guard(_state->get_handshake_ioc());
+                    _state->get_handshake_ioc().run();
+                });
+        for (auto i = _config->worker_threads_; i > 0; --i)
+            vector_of_threads_.emplace_back(
+                [_state = this->state_->shared_from_this()]() {
+                    auto _guard = boost::asio::make_work_guard(_state->get_workers().get_ioc());
+                    _state->get_workers().get_ioc().run();
+                });
+        if (!_config->publish_log_path_.empty() || !_config->snapshot_path_.empty())
+            vector_of_threads_.emplace_back(
+                [_state = this->state_->shared_from_this()]() {
+                    auto _guard = boost::asio::make_work_guard(_state->get_log_ioc());
+                    _state->get_log_ioc().run();
+                });
         for (auto i = _config->threads_ - 1; i > 0; --i)
             vector_of_threads_.emplace_back(
                 [_state = this->state_->shared_from_this()]() {
@@ -102,14 +193,28 @@ namespace engine {
             connect_to_remote();
         }
 
+        // Los pares conocidos antes de reiniciar se adoptan al registrarse y solo se concilian las diferencias.
+        state_->load_snapshot();
+
+        state_->prepare_ssl_contexts();
+
         start_session_listener();
 
         start_client_listener();
 
+        if (!_config->clients_socket_path_.empty())
+            start_local_client_listener();
+
         if (_config->repl_enabled) {
-            repl_ = std::make_unique<repl>(state_);
+            repl_ = std::make_unique<repl>(state_, [this] { drain(); });
         }
 
+        state_->start_load_reports();
+
+        state_->start_log_sync();
+
+        state_->start_snapshots();
+
 
         run_in_threads();
     }
@@ -126,9 +231,50 @@ namespace engine {
         auto const &_config = state_->get_config();
         _config->address_ = vm["address"].as<std::string>();
         _config->threads_ = vm["threads"].as<unsigned short>();
+        _config->handshake_threads_ = vm["handshake_threads"].as<unsigned short>();
+        _config->session_lanes_ = vm["session_lanes"].as<unsigned short>();
+        _config->topology_ = vm["topology"].as<std::string>();
+        _config->relay_max_hops_ = vm["relay_max_hops"].as<unsigned short>();
+        _config->session_batch_messages_ = vm["session_batch_messages"].as<std::size_t>();
+        _config->session_batch_bytes_ = vm["session_batch_bytes"].as<std::size_t>();
+        _config->session_batch_delay_ = vm["session_batch_delay"].as<std::size_t>();
+        _config->peer_retention_ = vm["peer_retention"].as<unsigned short>();
+        _config->session_heartbeat_interval_ = vm["session_heartbeat_interval"].as<std::size_t>();
+        _config->session_heartbeat_misses_ = vm["session_heartbeat_misses"].as<unsigned short>();
+        _config->load_report_interval_ = vm["load_report_interval"].as<std::size_t>();
+        _config->load_threshold_ = vm["load_threshold"].as<std::size_t>();
+        _config->drain_deadline_ = vm["drain_deadline"].as<std::size_t>();
+        _config->dedup_ttl_ = vm["dedup_ttl"].as<std::size_t>();
+        _config->dedup_capacity_ = vm["dedup_capacity"].as<std::size_t>();
+        _config->history_messages_ = vm["history_messages"].as<std::size_t>();
+        _config->history_bytes_ = vm["history_bytes"].as<std::size_t>();
+        _config->history_age_ = vm["history_age"].as<std::size_t>();
+        _config->last_value_channels_ = vm["last_value_channels"].as<std::size_t>();
+        _config->client_rate_limit_ = vm["client_rate_limit"].as<std::size_t>();
+        _config->fanout_rate_limit_ = vm["fanout_rate_limit"].as<std::size_t>();
+        _config->channel_rate_limit_ = vm["channel_rate_limit"].as<std::size_t>();
+        _config->rate_limit_burst_ = vm["rate_limit_burst"].as<std::size_t>();
+        _config->queue_control_weight_ = vm["queue_control_weight"].as<std::size_t>();
+        _config->conflated_channels_ = vm["conflated_channels"].as<std::string>();
+        _config->batch_max_requests_ = vm["batch_max_requests"].as<std::size_t>();
+        _config->worker_threads_ = vm["worker_threads"].as<unsigned short>();
+        _config->worker_queue_capacity_ = vm["worker_queue_capacity"].as<std::size_t>();
+        _config->publish_log_path_ = vm["publish_log_path"].as<std::string>();
+        _config->publish_log_segment_bytes_ = vm["publish_log_segment_bytes"].as<std::size_t>();
+        _config->publish_log_segments_ = vm["publish_log_segments"].as<std::size_t>();
+        _config->publish_log_fsync_ = vm["publish_log_fsync"].as<std::string>();
+        _config->publish_log_fsync_interval_ = vm["publish_log_fsync_interval"].as<std::size_t>();
+        _config->publish_log_replay_bytes_ = vm["publish_log_replay_bytes"].as<std::size_t>();
+        _config->snapshot_path_ = vm["snapshot_path"].as<std::string>();
+        _config->snapshot_interval_ = vm["snapshot_interval"].as<std::size_t>();
+        _config->reliable_messages_ = vm["reliable_messages"].as<std::size_t>();
+        _config->reliable_bytes_ = vm["reliable_bytes"].as<std::size_t>();
+        _config->reliable_retention_ = vm["reliable_retention"].as<unsigned short>();
+        _config->reliable_orphans_ = vm["reliable_orphans"].as<std::size_t>();
         _config->is_node_ = vm["is_node"].as<bool>();
         _config->sessions_port_ = vm["sessions_port"].as<unsigned short>();
         _config->clients_port_ = vm["clients_port"].as<unsigned short>();
+        _config->clients_socket_path_ = vm["clients_socket_path"].as<std::string>();
         _config->remote_address_ = vm["remote_address"].as<std::string>();
         _config->remote_sessions_port_ = vm["remote_sessions_port"].as<unsigned short>();
         _config->remote_clients_port_ = vm["remote_clients_port"].as<unsigned short>();
@@ -136,9 +282,69 @@ namespace engine {
         _config->ssl_session_listener_password_ = vm["ssl_session_listener_password"].as<std::string>();
         _config->ssl_session_password_ = vm["ssl_session_password"].as<std::string>();
         _config->ssl_client_password_ = vm["ssl_client_password"].as<std::string>();
+        _config->ssl_ktls_enabled_ = vm["ssl_ktls"].as<bool>();
+
+        state_->prepare_ssl_contexts();
     }
 
     void server::stop() const {
+        if (!state_->get_config()->snapshot_path_.empty())
+            state_->save_snapshot();
+
+        state_->get_handshake_ioc().stop();
+        state_->get_workers().get_ioc().stop();
+        state_->get_log_ioc().stop();
         state_->get_ioc().stop();
     }
+
+    void server::drain() {
+        std::call_once(drain_once_, [this] { do_drain(); });
+    }
+
+    void server::do_drain() {
+        const auto _deadline = std::chrono::milliseconds(state_->get_config()->drain_deadline_);
+
+        if (session_listener_)
+            session_listener_->stop();
+
+        if (client_listener_)
+            client_listener_->stop();
+
+        if (local_client_listener_)
+            local_client_listener_->stop();
+
+        // Las reconexiones se escalonan en la mitad de la ventana, la otra mitad queda para vaciar las colas.
+        state_->drain(_deadline / 2);
+
+        drain_deadline_ = std::chrono::steady_clock::now() + _deadline;
+        drain_timer_ = std::make_unique<boost::asio::steady_timer>(state_->get_ioc());
+        on_drain_timer(boost::system::error_code{});
+    }
+
+    void server::on_drain_timer(const boost::system::error_code &ec) {
+        if (ec)
+            return;
+
+        const auto _load = state_->get_load();
+        const auto _expired = std::chrono::steady_clock::now() >= drain_deadline_;
+
+        if (!sessions_closing_ && ((_load.clients_ == 0 && _load.queued_ == 0) || _expired)) {
+            // Las instancias vecinas reciben el cierre de websocket en lugar de perder la conexión al detenerse.
+            sessions_closing_ = true;
+            for (const auto &_session: state_->get_sessions())
+                _session->close();
+
+            drain_deadline_ = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        } else if (sessions_closing_ && (state_->get_sessions().empty() || _expired)) {
+            LOG_INFO("state_id=[{}] action=[drained] clients=[{}] queued=[{}] expired=[{}]",
+                     to_string(state_->get_id()), _load.clients_, _load.queued_, _expired);
+            stop();
+            return;
+        }
+
+        drain_timer_->expires_after(std::chrono::milliseconds(50));
+        drain_timer_->async_wait([_server = shared_from_this()](const boost::system::error_code &_ec) {
+            _server->on_drain_timer(_ec);
+        });
+    }
 } // namespace engine
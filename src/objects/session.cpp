@@ -8,6 +8,8 @@
 
 #include <engine/logger.hpp>
 #include <engine/response.hpp>
+#include <engine/validator.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/asio/ssl/host_name_verification.hpp>
 #include <boost/asio/ssl/stream_base.hpp>
 #include <boost/core/ignore_unused.hpp>
@@ -16,14 +18,53 @@
 #include <boost/uuid/random_generator.hpp>
 #include <boost/json/parse.hpp>
 #include <boost/json/serialize.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <cstdlib>
 
 namespace engine {
+    namespace {
+        /**
+         * Is Register Ack
+         *
+         * @param data
+         * @param transaction_id
+         * @return bool
+         */
+        bool is_register_ack(const boost::json::object &data, const std::string &transaction_id) {
+            const auto _is = [&data](const char *field, const std::string_view value) {
+                return data.contains(field) && data.at(field).is_string() && data.at(field).as_string() == value;
+            };
+
+            return _is("action", "ack") && _is("transaction_id", transaction_id) && _is("status", "success") &&
+                   _is("message", "ok");
+        }
+
+        /**
+         * Get Reply
+         *
+         * @param response
+         * @return shared_ptr<string const> Null when the message was an ack
+         */
+        std::shared_ptr<std::string const> get_reply(const std::shared_ptr<response> &response) {
+            if (response->is_ack())
+                return nullptr;
+
+            return std::make_shared<std::string const>(serialize(response->get_data()));
+        }
+    }
+
     session::session(const std::shared_ptr<state> &state,
                      boost::asio::ip::tcp::socket &&socket, const session_context context, const boost::uuids::uuid id)
         : context_(context), state_(state),
           id_(id),
+          peer_id_(id),
           socket_(std::move(socket),
-                  context == remote ? state->get_session_ssl_context() : state->get_session_listener_ssl_context()) {
+                  context == remote ? state->get_session_ssl_context() : state->get_session_listener_ssl_context()),
+          queue_(state->get_config()->queue_control_weight_),
+          batch_timer_(socket_.get_executor()),
+          heartbeat_timer_(socket_.get_executor()) {
         LOG_INFO("state_id=[{}] action=[session_allocated] session_id=[{}]", to_string(state_->get_id()),
                  to_string(id_));
     }
@@ -32,21 +73,57 @@ namespace engine {
         LOG_INFO("state_id=[{}] action=[session_released] session_id=[{}]", to_string(state_->get_id()),
                  to_string(id_));
 
-        state_->remove_state_of_session(id_);
+        state_->add_queued(-static_cast<std::int64_t>(queue_.size()));
+
+        // Lo conocido de la instancia remota se conserva por si vuelve a registrarse con el mismo nodo.
+        if (lane_ == 0 && !node_id_.is_nil() && state_->get_config()->peer_retention_ > 0)
+            state_->retain_state_of_session(id_, node_id_, peer_version_.load(std::memory_order_acquire));
+        else
+            state_->remove_state_of_session(id_);
     }
 
     boost::uuids::uuid session::get_id() const { return id_; }
 
-    boost::beast::websocket::stream<boost::asio::ssl::stream<boost::beast::tcp_stream> > &session::get_socket() {
+    boost::beast::websocket::stream<tls_stream> &session::get_socket() {
         return socket_;
     }
 
-    void session::send(std::shared_ptr<std::string const> const &data) {
+    void session::send(std::shared_ptr<std::string const> const &data, const priority priority) {
         boost::ignore_unused(data);
 
-        if (socket_.is_open()) {
-            post(socket_.get_executor(), boost::beast::bind_front_handler(&session::on_send, shared_from_this(), data));
+        // Una sesión caída no acumula mensajes en su cola.
+        if (socket_.is_open() && is_healthy()) {
+            post(socket_.get_executor(),
+                 boost::beast::bind_front_handler(&session::on_send, shared_from_this(), data, priority));
+        }
+    }
+
+    void session::send(std::shared_ptr<std::string const> const &data, const std::string_view key) {
+        std::shared_ptr<session> _lane; {
+            std::shared_lock _lock(lanes_mutex_);
+            if (!lanes_.empty())
+                _lane = lanes_[std::hash<std::string_view>{}(key) % lanes_.size()];
+
+            // El carril asignado dejó de responder, la llave se mueve al camino con menor latencia.
+            if (_lane && !_lane->is_healthy()) {
+                _lane = nullptr;
+                for (const auto &_candidate: lanes_) {
+                    if (_candidate && _candidate->is_healthy() && (!_lane || _candidate->get_rtt() < _lane->get_rtt()))
+                        _lane = _candidate;
+                }
+
+                if (_lane && is_healthy() && get_rtt() <= _lane->get_rtt())
+                    _lane = nullptr;
+            }
+        }
+
+        // Sin carril disponible el mensaje viaja por la sesión principal.
+        if (_lane) {
+            _lane->send(data, bulk);
+            return;
         }
+
+        send(data, bulk);
     }
 
     void session::run() {
@@ -86,10 +163,82 @@ namespace engine {
         return registered_.load(std::memory_order_acquire);
     }
 
+    boost::uuids::uuid session::get_node_id() const {
+        std::scoped_lock _lock(node_id_mutex_);
+        return node_id_;
+    }
+
+    void session::set_node_id(const boost::uuids::uuid node_id) {
+        std::scoped_lock _lock(node_id_mutex_);
+        node_id_ = node_id;
+    }
+
+    std::int64_t session::get_peer_version() const {
+        return peer_version_.load(std::memory_order_acquire);
+    }
+
+    void session::set_peer_version(const std::int64_t version) {
+        peer_version_.store(version, std::memory_order_release);
+    }
+
+    std::int64_t session::get_rtt() const {
+        return rtt_.load(std::memory_order_acquire);
+    }
+
+    std::int64_t session::get_jitter() const {
+        return jitter_.load(std::memory_order_acquire);
+    }
+
+    bool session::is_healthy() const {
+        return healthy_.load(std::memory_order_acquire);
+    }
+
+    std::optional<load> session::get_load() const {
+        std::scoped_lock _lock(load_mutex_);
+        return load_;
+    }
+
+    void session::set_load(const load &load) {
+        std::scoped_lock _lock(load_mutex_);
+        load_ = load;
+    }
+
+    unsigned short session::get_lane() const {
+        return lane_;
+    }
+
+    std::size_t session::get_lanes_count() const {
+        std::shared_lock _lock(lanes_mutex_);
+        return std::ranges::count_if(lanes_, [](const auto &_lane) { return _lane != nullptr; });
+    }
+
+    void session::attach_lane(const std::shared_ptr<session> &lane, const unsigned short number) {
+        if (number == 0)
+            return;
+
+        lane->lane_ = number;
+        lane->peer_id_ = peer_id_;
+        lane->primary_ = weak_from_this();
+
+        std::unique_lock _lock(lanes_mutex_);
+        if (lanes_.size() < number)
+            lanes_.resize(number);
+
+        lanes_[number - 1] = lane;
+    }
+
+    void session::detach_lane(const std::shared_ptr<session> &lane) {
+        std::unique_lock _lock(lanes_mutex_);
+        for (auto &_lane: lanes_) {
+            if (_lane == lane)
+                _lane.reset();
+        }
+    }
+
     void session::on_run() {
         switch (context_) {
             case local: {
-                get_lowest_layer(socket_).expires_after(std::chrono::seconds(30));
+                boost::beast::get_lowest_layer(socket_).expires_after(std::chrono::seconds(30));
 
                 socket_.next_layer().async_handshake(
                     boost::asio::ssl::stream_base::server,
@@ -116,7 +265,7 @@ namespace engine {
 
     void session::on_accept(const boost::beast::error_code &ec) {
         if (ec) {
-            state_->remove_session(id_);
+            remove_from_state();
             return;
         }
 
@@ -126,23 +275,45 @@ namespace engine {
         if (context_ == remote) {
             // Apenas se conecta procede a registrarse
             auto const &_config = state_->get_config();
+            register_transaction_id_ = to_string(boost::uuids::random_generator()());
+
+            boost::json::object _params = {
+                {"registered", _config->registered_.load(std::memory_order_acquire)},
+                {"clients_port", _config->clients_port_.load(std::memory_order_acquire)},
+                {"sessions_port", _config->sessions_port_.load(std::memory_order_acquire)},
+                {"state_id", to_string(state_->get_id())},
+            };
+
+            // Los carriles se identifican con la instancia y su número para unirse a la sesión principal
+            if (lane_ > 0) {
+                _params["registered"] = true;
+                _params["lane"] = lane_;
+            }
+
             const boost::json::object _response = {
-                {"transaction_id", to_string(boost::uuids::random_generator()())},
+                {"transaction_id", register_transaction_id_},
                 {"action", "register"},
-                {
-                    "params", {
-                        {"registered", _config->registered_.load(std::memory_order_acquire)},
-                        {"clients_port", _config->clients_port_.load(std::memory_order_acquire)},
-                        {"sessions_port", _config->sessions_port_.load(std::memory_order_acquire)},
-                    }
-                },
+                {"params", _params},
             };
+
             // Para evitar que las siguientes conexiones remitan el listado de sesiones se marca una bandera
-            _config->registered_.store(true, std::memory_order_release);
+            if (lane_ == 0)
+                _config->registered_.store(true, std::memory_order_release);
 
             send(std::make_shared<std::string const>(serialize(_response)));
+
+            if (lane_ > 0) {
+                const auto _primary = primary_.lock();
+                if (!_primary) {
+                    do_tls_shutdown();
+                    return;
+                }
+
+                _primary->attach_lane(shared_from_this(), lane_);
+            }
         }
 
+        start_heartbeat();
         do_read();
     }
 
@@ -155,12 +326,14 @@ namespace engine {
                 ec.value(),
                 ec.message()
             );
-            state_->remove_session(id_);
+            remove_from_state();
 
             do_tls_shutdown();
             return;
         }
 
+        enable_kernel_tx(boost::asio::ssl::stream_base::client);
+
         const auto _host = fmt::format("{}:{}", state_->get_config()->remote_address_,
                                        std::to_string(
                                            state_->get_config()->remote_sessions_port_.load(
@@ -183,12 +356,14 @@ namespace engine {
                 ec.value(),
                 ec.message()
             );
-            state_->remove_session(id_);
+            remove_from_state();
             do_tls_shutdown();
             return;
         }
 
-        get_lowest_layer(socket_).expires_never();
+        boost::beast::get_lowest_layer(socket_).expires_never();
+
+        enable_kernel_tx(boost::asio::ssl::stream_base::server);
 
         socket_.set_option(
                     boost::beast::websocket::stream_base::timeout::suggested(boost::beast::role_type::server));
@@ -197,6 +372,87 @@ namespace engine {
             boost::beast::bind_front_handler(&session::on_accept, shared_from_this()));
     }
 
+    void session::enable_kernel_tx(const boost::asio::ssl::stream_base::handshake_type type) {
+        if (!state_->get_config()->ssl_ktls_enabled_)
+            return;
+
+        const auto _kernel_tx = socket_.next_layer().enable_kernel_tx(type);
+        LOG_INFO("state_id=[{}] action=[ktls] session_id=[{}] kernel_tx=[{}]", to_string(state_->get_id()),
+                 to_string(id_), _kernel_tx);
+    }
+
+    void session::open_lanes() {
+        const auto _lanes = state_->get_config()->session_lanes_;
+        if (_lanes <= 1)
+            return;
+
+        boost::system::error_code _ec;
+        const auto _endpoint = boost::beast::get_lowest_layer(socket_).socket().remote_endpoint(_ec);
+        if (_ec)
+            return;
+
+        // Las posiciones se reservan desde el inicio para que el reparto por llave no cambie al conectar cada carril.
+        {
+            std::unique_lock _lock(lanes_mutex_);
+            lanes_.resize(_lanes - 1);
+        }
+
+        for (unsigned short _number = 1; _number < _lanes; ++_number) {
+            const auto _lane = std::make_shared<session>(
+                state_, boost::asio::ip::tcp::socket{make_strand(state_->get_ioc())}, remote);
+            _lane->lane_ = _number;
+            _lane->peer_id_ = id_;
+            _lane->primary_ = weak_from_this();
+
+            boost::beast::get_lowest_layer(_lane->socket_).async_connect(
+                _endpoint,
+                boost::beast::bind_front_handler(&session::on_lane_connect, _lane));
+        }
+    }
+
+    void session::on_lane_connect(const boost::system::error_code &ec) {
+        if (ec) {
+            LOG_INFO(
+                "session_id=[{}] on_lane_connect lane=[{}] ec=[{}:{}] msg=[{}]",
+                to_string(id_),
+                lane_,
+                ec.category().name(),
+                ec.value(),
+                ec.message()
+            );
+            return;
+        }
+
+        LOG_INFO("state_id=[{}] action=[lane_connected] session_id=[{}] peer_id=[{}] lane=[{}]",
+                 to_string(state_->get_id()), to_string(id_), to_string(peer_id_), lane_);
+
+        run();
+    }
+
+    void session::close_lanes() {
+        std::vector<std::shared_ptr<session> > _lanes; {
+            std::unique_lock _lock(lanes_mutex_);
+            _lanes.swap(lanes_);
+        }
+
+        for (const auto &_lane: _lanes) {
+            if (_lane)
+                _lane->do_tls_shutdown();
+        }
+    }
+
+    void session::remove_from_state() {
+        // Un carril no pertenece al estado, solo se desliga de su sesión principal.
+        if (lane_ > 0) {
+            if (const auto _primary = primary_.lock())
+                _primary->detach_lane(shared_from_this());
+            return;
+        }
+
+        state_->remove_session(id_);
+        close_lanes();
+    }
+
     void session::do_read() {
         socket_.async_read(buffer_, boost::beast::bind_front_handler(&session::on_read, shared_from_this()));
     }
@@ -212,7 +468,7 @@ namespace engine {
                 ec.value(),
                 ec.message()
             );
-            state_->remove_session(id_);
+            remove_from_state();
             do_tls_shutdown();
             return;
         }
@@ -225,20 +481,28 @@ namespace engine {
                 ec.value(),
                 ec.message()
             );
-            state_->remove_session(id_);
+            remove_from_state();
             do_tls_shutdown();
             return;
         }
 
+        last_seen_at_ = std::chrono::steady_clock::now();
+
         const auto _read_at = std::chrono::system_clock::now().time_since_epoch().count();
         const auto _stream = boost::beast::buffers_to_string(buffer_.data());
 
         boost::system::error_code _parse_ec;
 
-        if (auto _data = boost::json::parse(_stream, _parse_ec); !_parse_ec && _data.is_object()) {
-            if (const auto _response = kernel(state_, _data.as_object(), on_session, get_id()); !_response->is_ack()) {
-                send(std::make_shared<std::string const>(serialize(_response->get_data())));
-            }
+        // Un arreglo corresponde a un lote de mensajes agrupados por la instancia remota.
+        auto _data = boost::json::parse(_stream, _parse_ec);
+        const auto _is_batch = !_parse_ec && _data.is_array() && std::ranges::all_of(
+                                   _data.as_array(), [](const auto &_entry) { return _entry.is_object(); });
+
+        if (_is_batch) {
+            for (const auto &_entry: _data.as_array())
+                on_message(_entry.as_object());
+        } else if (!_parse_ec && _data.is_object()) {
+            on_message(_data.as_object());
         } else {
             auto _now = std::chrono::system_clock::now().time_since_epoch().count();
             const boost::json::object _response = {
@@ -253,7 +517,7 @@ namespace engine {
                 {"timestamp", _now},
                 {"runtime", _now - _read_at},
             };
-            send(std::make_shared<std::string const>(serialize(_response)));
+            on_reply(replies_.reserve(), std::make_shared<std::string const>(serialize(_response)));
         }
 
         buffer_.consume(buffer_.size());
@@ -261,30 +525,316 @@ namespace engine {
         do_read();
     }
 
-    void session::on_send(std::shared_ptr<std::string const> const &data) {
-        queue_.push_back(data);
+    void session::on_message(const boost::json::object &data) {
+        // Mensaje retransmitido que volvió a su origen, se descarta.
+        if (state_->is_loop(data)) {
+            LOG_INFO("state_id=[{}] action=[relay] session_id=[{}] status=[loop]", to_string(state_->get_id()),
+                     to_string(id_));
+            return;
+        }
+
+        if (state_->is_duplicate(data)) {
+            LOG_INFO("state_id=[{}] action=[dedup] session_id=[{}] status=[duplicate]", to_string(state_->get_id()),
+                     to_string(id_));
+            return;
+        }
+
+        // Los carriles se abren una vez que la instancia remota aceptó el registro de la sesión principal.
+        if (context_ == remote && lane_ == 0 && !register_transaction_id_.empty() &&
+            is_register_ack(data, register_transaction_id_)) {
+            register_transaction_id_.clear();
+            on_register_ack(data);
+            open_lanes();
+        }
+
+        const auto _slot = replies_.reserve();
+        const auto _response = kernel(state_, data, on_session, peer_id_, nullptr, socket_.get_executor(),
+                                      [_self = shared_from_this(), _slot](const std::shared_ptr<response> &response) {
+                                          _self->on_reply(_slot, get_reply(response));
+                                      });
+
+        if (!_response->is_deferred())
+            on_reply(_slot, get_reply(_response));
+    }
+
+    void session::on_reply(const std::uint64_t slot, std::shared_ptr<std::string const> message) {
+        for (const auto &_message: replies_.complete(slot, std::move(message)))
+            send(_message);
+    }
+
+    void session::on_register_ack(const boost::json::object &data) {
+        if (!data.contains("data") || !data.at("data").is_object())
+            return;
+
+        const auto &_data = data.at("data").as_object();
+
+        if (_data.contains("state_id") && _data.at("state_id").is_string() &&
+            validator::is_uuid(_data.at("state_id").as_string().c_str())) {
+            const auto _node_id = boost::lexical_cast<boost::uuids::uuid>(_data.at("state_id").as_string().c_str());
+            set_node_id(_node_id);
+            peer_version_.store(state_->adopt_state_of_session(id_, _node_id), std::memory_order_release);
+        }
+
+        // Se concilia lo que la instancia remota anuncia y se le envía el digest propio para que haga lo mismo.
+        if (_data.contains("digest") && _data.at("digest").is_array() && _data.contains("version") &&
+            _data.at("version").is_int64()) {
+            if (const auto _remote = digest::from_array(_data.at("digest").as_array()); _remote.has_value())
+                state_->reconcile(shared_from_this(), _remote.value(), _data.at("version").as_int64());
+        }
+
+        const boost::json::object _digest = {
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "digest"},
+            {
+                "params", {
+                    {"buckets", state_->get_digest(id_).to_array()},
+                    {"version", state_->get_version()},
+                }
+            }
+        };
+
+        send(std::make_shared<std::string const>(serialize(_digest)));
+    }
+
+    void session::on_send(std::shared_ptr<std::string const> const &data, const priority priority) {
+        if (!is_healthy())
+            return;
+
+        const auto &_config = state_->get_config();
+
+        // Los mensajes de control no esperan al lote.
+        if (_config->session_batch_messages_ <= 1 || priority == control) {
+            do_write(data, priority);
+            return;
+        }
+
+        // Un mensaje que por sí solo alcanza el límite no se agrupa.
+        if (data->size() >= _config->session_batch_bytes_) {
+            flush_batch();
+            do_write(data, bulk);
+            return;
+        }
+
+        if (batch_bytes_ + data->size() + 1 > _config->session_batch_bytes_)
+            flush_batch();
+
+        batch_.push_back(data);
+        batch_bytes_ += data->size() + 1;
+
+        if (batch_.size() >= _config->session_batch_messages_) {
+            flush_batch();
+            return;
+        }
+
+        if (batch_scheduled_)
+            return;
+
+        batch_scheduled_ = true;
+
+        if (_config->session_batch_delay_ == 0) {
+            post(socket_.get_executor(),
+                 boost::beast::bind_front_handler(&session::on_batch_timer, shared_from_this(),
+                                                  boost::system::error_code{}));
+            return;
+        }
+
+        batch_timer_.expires_after(std::chrono::microseconds(_config->session_batch_delay_));
+        batch_timer_.async_wait(boost::beast::bind_front_handler(&session::on_batch_timer, shared_from_this()));
+    }
+
+    void session::flush_batch() {
+        if (batch_.empty())
+            return;
+
+        if (batch_.size() == 1) {
+            do_write(batch_.front(), bulk);
+        } else {
+            // Los mensajes ya están serializados, el lote se arma sin volver a interpretarlos.
+            std::string _frame;
+            _frame.reserve(batch_bytes_ + 1);
+            _frame.push_back('[');
+            for (std::size_t _i = 0; _i < batch_.size(); ++_i) {
+                if (_i > 0)
+                    _frame.push_back(',');
+                _frame.append(*batch_[_i]);
+            }
+            _frame.push_back(']');
+
+            do_write(std::make_shared<std::string const>(std::move(_frame)), bulk);
+        }
+
+        batch_.clear();
+        batch_bytes_ = 0;
+    }
+
+    void session::on_batch_timer(const boost::system::error_code &ec) {
+        batch_scheduled_ = false;
+
+        if (ec)
+            return;
+
+        flush_batch();
+    }
+
+    void session::do_write(std::shared_ptr<std::string const> const &data, const priority priority) {
+        state_->add_queued(1);
 
-        if (queue_.size() > 1)
+        if (queue_.push(data, priority, std::chrono::steady_clock::now()))
+            write_next();
+    }
+
+    void session::write_next() {
+        const auto _item = queue_.next();
+        if (_item == nullptr)
             return;
 
-        const auto _message = *queue_.begin();
+        state_->record_queue_latency(_item->priority_, std::chrono::steady_clock::now() - _item->queued_at_);
 
-        socket_.async_write(boost::asio::buffer(*queue_.front()),
+        socket_.async_write(boost::asio::buffer(*_item->data_),
                             boost::beast::bind_front_handler(&session::on_write, shared_from_this()));
     }
 
+    void session::start_heartbeat() {
+        last_seen_at_ = std::chrono::steady_clock::now();
+
+        const auto _interval = state_->get_config()->session_heartbeat_interval_;
+        if (_interval == 0)
+            return;
+
+        // El callback vive dentro del stream, capturar la sesión por valor impediría liberarla.
+        socket_.control_callback([this](const boost::beast::websocket::frame_type kind,
+                                        const boost::beast::string_view payload) {
+            on_control(kind, payload);
+        });
+
+        heartbeat_timer_.expires_after(std::chrono::milliseconds(_interval));
+        heartbeat_timer_.async_wait(
+            boost::beast::bind_front_handler(&session::on_heartbeat_timer, shared_from_this()));
+    }
+
+    void session::on_heartbeat_timer(const boost::system::error_code &ec) {
+        if (ec || tls_shutdown_started_.load(std::memory_order_acquire) || !socket_.is_open())
+            return;
+
+        const auto &_config = state_->get_config();
+        const auto _interval = std::chrono::milliseconds(_config->session_heartbeat_interval_);
+        const auto _misses = std::max<unsigned short>(_config->session_heartbeat_misses_, 1);
+        const auto _now = std::chrono::steady_clock::now();
+
+        // Sin noticias del par durante varios intervalos se considera caído antes que el timeout de TCP.
+        if (_now - last_seen_at_ > _interval * _misses) {
+            mark_as_dead();
+            return;
+        }
+
+        if (!heartbeat_pending_) {
+            heartbeat_pending_ = true;
+            heartbeat_sent_at_ = _now;
+
+            const auto _sequence = std::to_string(++heartbeat_sequence_);
+            socket_.async_ping(boost::beast::websocket::ping_data{_sequence.c_str()},
+                               boost::beast::bind_front_handler(&session::on_ping, shared_from_this()));
+        }
+
+        heartbeat_timer_.expires_after(_interval);
+        heartbeat_timer_.async_wait(
+            boost::beast::bind_front_handler(&session::on_heartbeat_timer, shared_from_this()));
+    }
+
+    void session::on_ping(const boost::system::error_code &ec) {
+        if (ec) {
+            LOG_INFO(
+                "session_id=[{}] on_ping ec=[{}:{}] msg=[{}]",
+                to_string(id_),
+                ec.category().name(),
+                ec.value(),
+                ec.message()
+            );
+        }
+    }
+
+    void session::on_control(const boost::beast::websocket::frame_type kind, const boost::beast::string_view payload) {
+        const auto _now = std::chrono::steady_clock::now();
+        last_seen_at_ = _now;
+
+        if (kind != boost::beast::websocket::frame_type::pong || !heartbeat_pending_ ||
+            payload != std::to_string(heartbeat_sequence_))
+            return;
+
+        heartbeat_pending_ = false;
+
+        const auto _sample = std::chrono::duration_cast<std::chrono::microseconds>(_now - heartbeat_sent_at_).count();
+        const auto _rtt = rtt_.load(std::memory_order_acquire);
+
+        // Estimación suavizada como en TCP (RFC 6298): 1/8 para el RTT y 1/4 para su variación.
+        if (_rtt < 0) {
+            rtt_.store(_sample, std::memory_order_release);
+            jitter_.store(_sample / 2, std::memory_order_release);
+            return;
+        }
+
+        const auto _jitter = jitter_.load(std::memory_order_acquire);
+        jitter_.store((3 * _jitter + std::abs(_rtt - _sample)) / 4, std::memory_order_release);
+        rtt_.store((7 * _rtt + _sample) / 8, std::memory_order_release);
+    }
+
+    void session::mark_as_dead() {
+        if (!healthy_.exchange(false, std::memory_order_acq_rel))
+            return;
+
+        LOG_INFO("state_id=[{}] action=[heartbeat] session_id=[{}] lane=[{}] rtt=[{}] status=[dead]",
+                 to_string(state_->get_id()), to_string(id_), lane_, get_rtt());
+
+        remove_from_state();
+
+        heartbeat_timer_.cancel();
+        batch_timer_.cancel();
+
+        // Un par que no responde tampoco completaría el cierre TLS, se cierra el socket directamente.
+        tls_shutdown_started_.store(true, std::memory_order_release);
+
+        boost::system::error_code _ec;
+        boost::beast::get_lowest_layer(socket_).socket().shutdown(boost::asio::ip::tcp::socket::shutdown_both, _ec);
+        boost::beast::get_lowest_layer(socket_).socket().close(_ec);
+    }
+
     void session::on_write(const boost::beast::error_code &ec, std::size_t bytes_transferred) {
         if (ec)
             return;
 
-        queue_.erase(queue_.begin());
+        queue_.complete();
+        state_->add_queued(-1);
+
+        write_next();
+    }
+
+    void session::close() {
+        if (tls_shutdown_started_.exchange(true, std::memory_order_acq_rel))
+            return;
+
+        post(socket_.get_executor(), [self = shared_from_this()] {
+            self->heartbeat_timer_.cancel();
+            self->batch_timer_.cancel();
 
-        if (!queue_.empty())
-            socket_.async_write(
-                boost::asio::buffer(*queue_.front()),
-                boost::beast::bind_front_handler(
-                    &session::on_write,
-                    shared_from_this()));
+            std::vector<std::shared_ptr<session> > _lanes; {
+                std::shared_lock _lock(self->lanes_mutex_);
+                _lanes = self->lanes_;
+            }
+
+            for (const auto &_lane: _lanes) {
+                if (_lane)
+                    _lane->close();
+            }
+
+            // El par responde el cierre y termina su lado con close_notify, nada queda a medio escribir.
+            const boost::beast::websocket::close_reason _reason{boost::beast::websocket::close_code::going_away};
+            self->socket_.async_close(_reason, boost::beast::bind_front_handler(&session::on_close, self));
+        });
+    }
+
+    void session::on_close(const boost::system::error_code &ec) {
+        remove_from_state();
+        on_tls_shutdown_complete(ec);
     }
 
     void session::do_tls_shutdown() {
@@ -309,8 +859,10 @@ namespace engine {
     }
 
     void session::on_tls_shutdown_complete(const boost::system::error_code &ec) {
+        heartbeat_timer_.cancel();
+
         boost::system::error_code ignored;
-        get_lowest_layer(socket_).socket().shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored);
-        get_lowest_layer(socket_).socket().close(ignored);
+        boost::beast::get_lowest_layer(socket_).socket().shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored);
+        boost::beast::get_lowest_layer(socket_).socket().close(ignored);
     }
 } // namespace engine
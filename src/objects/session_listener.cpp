@@ -3,6 +3,7 @@
 
 #include <engine/session_listener.hpp>
 
+#include <boost/asio/post.hpp>
 #include <boost/asio/strand.hpp>
 
 #include <engine/logger.hpp>
@@ -54,7 +55,8 @@ namespace engine {
             _session->run();
         }
 
-        do_accept();
+        if (acceptor_.is_open())
+            do_accept();
     }
 
     void session_listener::do_accept() {
@@ -68,4 +70,11 @@ namespace engine {
     void session_listener::start() {
         do_accept();
     }
+
+    void session_listener::stop() {
+        post(acceptor_.get_executor(), [_listener = shared_from_this()] {
+            boost::system::error_code _ec;
+            _listener->acceptor_.close(_ec);
+        });
+    }
 } // namespace engine
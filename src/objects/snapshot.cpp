@@ -0,0 +1,259 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/snapshot.hpp>
+
+#include <engine/logger.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace engine {
+    namespace {
+        /**
+         * Magic
+         */
+        constexpr std::uint32_t magic = 0x504e5345;
+
+        /**
+         * Format
+         */
+        constexpr std::uint32_t format = 1;
+
+        /**
+         * Get Checksum
+         *
+         * @param data
+         * @return uint32_t FNV-1a of the data
+         */
+        std::uint32_t get_checksum(const std::string_view data) {
+            std::uint32_t _hash = 2166136261u;
+            for (const auto _character: data) {
+                _hash ^= static_cast<unsigned char>(_character);
+                _hash *= 16777619u;
+            }
+            return _hash;
+        }
+
+        /**
+         * Put
+         *
+         * @param buffer
+         * @param value
+         */
+        template<typename T>
+        void put(std::string &buffer, const T &value) {
+            buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        /**
+         * Reader
+         *
+         * Bounds checked cursor over the mapped file.
+         */
+        struct reader {
+            /**
+             * Data
+             */
+            const char *data_;
+
+            /**
+             * Size
+             */
+            std::size_t size_;
+
+            /**
+             * Offset
+             */
+            std::size_t offset_ = 0;
+
+            /**
+             * Get
+             *
+             * @param value
+             * @return bool False when the file ends before the value
+             */
+            template<typename T>
+            bool get(T &value) {
+                if (size_ - offset_ < sizeof(T))
+                    return false;
+
+                std::memcpy(&value, data_ + offset_, sizeof(T));
+                offset_ += sizeof(T);
+                return true;
+            }
+
+            /**
+             * Get
+             *
+             * @param value
+             * @param size
+             * @return bool False when the file ends before the value
+             */
+            bool get(std::string &value, const std::size_t size) {
+                if (size_ - offset_ < size)
+                    return false;
+
+                value.assign(data_ + offset_, size);
+                offset_ += size;
+                return true;
+            }
+        };
+
+        /**
+         * Parse
+         *
+         * @param data
+         * @param size
+         * @param peers
+         * @return bool
+         */
+        bool parse(const char *data, const std::size_t size, snapshot &peers) {
+            if (size < sizeof(std::uint32_t))
+                return false;
+
+            // El checksum cubre todo lo anterior y se valida antes de interpretar el contenido.
+            std::uint32_t _checksum;
+            std::memcpy(&_checksum, data + size - sizeof(_checksum), sizeof(_checksum));
+            if (get_checksum(std::string_view(data, size - sizeof(_checksum))) != _checksum)
+                return false;
+
+            reader _reader{.data_ = data, .size_ = size - sizeof(_checksum)};
+
+            std::uint32_t _magic;
+            std::uint32_t _format;
+            std::uint64_t _peers;
+            if (!_reader.get(_magic) || !_reader.get(_format) || !_reader.get(_peers) || _magic != magic ||
+                _format != format)
+                return false;
+
+            const auto _now = std::chrono::steady_clock::now();
+            for (std::uint64_t _i = 0; _i < _peers; ++_i) {
+                boost::uuids::uuid _node_id;
+                std::uint64_t _clients;
+                std::uint64_t _subscriptions;
+                retained_state _retained{.retained_at_ = _now};
+
+                if (!_reader.get(_node_id) || !_reader.get(_retained.version_) || !_reader.get(_clients) ||
+                    !_reader.get(_subscriptions))
+                    return false;
+
+                // Las cantidades se acotan por lo que queda del archivo antes de reservar.
+                const auto _available = _reader.size_ - _reader.offset_;
+                if (_clients > _available / sizeof(boost::uuids::uuid) ||
+                    _subscriptions > _available / (sizeof(boost::uuids::uuid) + sizeof(std::uint32_t)))
+                    return false;
+
+                _retained.clients_.resize(_clients);
+                for (auto &_client_id: _retained.clients_) {
+                    if (!_reader.get(_client_id))
+                        return false;
+                }
+
+                _retained.subscriptions_.resize(_subscriptions);
+                for (auto &[_client_id, _channel]: _retained.subscriptions_) {
+                    std::uint32_t _length;
+                    if (!_reader.get(_client_id) || !_reader.get(_length) || !_reader.get(_channel, _length))
+                        return false;
+                }
+
+                peers.insert_or_assign(_node_id, std::move(_retained));
+            }
+
+            return _reader.offset_ == _reader.size_;
+        }
+    }
+
+    bool write_snapshot(const std::filesystem::path &path, const snapshot &peers) {
+        std::string _buffer;
+        put(_buffer, magic);
+        put(_buffer, format);
+        put(_buffer, static_cast<std::uint64_t>(peers.size()));
+
+        for (const auto &[_node_id, _retained]: peers) {
+            put(_buffer, _node_id);
+            put(_buffer, _retained.version_);
+            put(_buffer, static_cast<std::uint64_t>(_retained.clients_.size()));
+            put(_buffer, static_cast<std::uint64_t>(_retained.subscriptions_.size()));
+
+            for (const auto &_client_id: _retained.clients_)
+                put(_buffer, _client_id);
+
+            for (const auto &[_client_id, _channel]: _retained.subscriptions_) {
+                put(_buffer, _client_id);
+                put(_buffer, static_cast<std::uint32_t>(_channel.size()));
+                _buffer.append(_channel);
+            }
+        }
+
+        put(_buffer, get_checksum(_buffer));
+
+        auto _temporary = path;
+        _temporary += ".tmp";
+
+        const int _fd = ::open(_temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (_fd < 0)
+            return false;
+
+        std::size_t _written = 0;
+        while (_written < _buffer.size()) {
+            const auto _result = ::write(_fd, _buffer.data() + _written, _buffer.size() - _written);
+            if (_result <= 0)
+                break;
+            _written += static_cast<std::size_t>(_result);
+        }
+
+        const bool _durable = _written == _buffer.size() && ::fsync(_fd) == 0;
+        ::close(_fd);
+
+        std::error_code _ec;
+        if (_durable)
+            std::filesystem::rename(_temporary, path, _ec);
+
+        if (!_durable || _ec) {
+            std::filesystem::remove(_temporary, _ec);
+            return false;
+        }
+
+        return true;
+    }
+
+    snapshot read_snapshot(const std::filesystem::path &path) {
+        snapshot _peers;
+
+        const int _fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (_fd < 0)
+            return _peers;
+
+        struct stat _stat{};
+        if (::fstat(_fd, &_stat) != 0 || _stat.st_size == 0) {
+            ::close(_fd);
+            return _peers;
+        }
+
+        const auto _size = static_cast<std::size_t>(_stat.st_size);
+        void *_data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+        ::close(_fd);
+
+        if (_data == MAP_FAILED)
+            return _peers;
+
+        ::madvise(_data, _size, MADV_SEQUENTIAL);
+
+        if (!parse(static_cast<const char *>(_data), _size, _peers)) {
+            LOG_INFO("action=[snapshot] path=[{}] status=[corrupted]", path.string());
+            _peers.clear();
+        }
+
+        ::munmap(_data, _size);
+        return _peers;
+    }
+} // namespace engine
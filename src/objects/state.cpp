@@ -7,18 +7,29 @@
 #include <engine/logger.hpp>
 #include <engine/subscription.hpp>
 #include <engine/request.hpp>
+#include <engine/tls_stream.hpp>
+#include <engine/publish_log.hpp>
+#include <engine/snapshot.hpp>
 
 #include <boost/uuid/random_generator.hpp>
 #include <boost/json/serialize.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <filesystem>
+#include <limits>
+#include <numeric>
 #include <ranges>
+#include <tuple>
 #include <unordered_set>
 
 #include <engine/utils.hpp>
 
 namespace engine {
     state::state(const std::shared_ptr<config> &config)
-        : session_listener_ssl_context_(boost::asio::ssl::context::sslv23), session_ssl_context_(boost::asio::ssl::context::sslv23), client_listener_ssl_context_(boost::asio::ssl::context::sslv23), client_ssl_context_(boost::asio::ssl::context::sslv23), config_(config), id_(boost::uuids::random_generator()()), created_at_(std::chrono::system_clock::now()) {
+        : session_listener_ssl_context_(boost::asio::ssl::context::sslv23), session_ssl_context_(boost::asio::ssl::context::sslv23), client_listener_ssl_context_(boost::asio::ssl::context::sslv23), client_ssl_context_(boost::asio::ssl::context::sslv23), config_(config), id_(boost::uuids::random_generator()()), created_at_(std::chrono::system_clock::now()), load_timer_(ioc_), log_timer_(log_ioc_), snapshot_timer_(log_ioc_) {
         LOG_INFO("state_id=[{}] action=[state_allocated]", to_string(id_));
 
         session_listener_ssl_context_.set_options(
@@ -75,6 +86,19 @@ namespace engine {
         client_ssl_context_.use_private_key_file(config_->ssl_client_private_key_, boost::asio::ssl::context::pem);
     }
 
+    void state::prepare_ssl_contexts() {
+        // La configuración se aplica después de construir el estado, por eso se prepara aparte y una sola vez.
+        if (!config_->ssl_ktls_enabled_)
+            return;
+
+        std::call_once(ssl_contexts_once_, [this] {
+            tls_stream::prepare_context(session_listener_ssl_context_, true);
+            tls_stream::prepare_context(session_ssl_context_, false);
+            tls_stream::prepare_context(client_listener_ssl_context_, true);
+            tls_stream::prepare_context(client_ssl_context_, false);
+        });
+    }
+
     state::~state() {
         LOG_INFO("state_id=[{}] action=[state_released]", to_string(id_));
     }
@@ -99,7 +123,7 @@ namespace engine {
     std::vector<std::shared_ptr<client> > state::get_clients() const {
         std::shared_lock _lock(clients_mutex_);
 
-        const auto &_index = clients_.get<clients_by_client>();
+        const auto &_index = clients_.get<clients_by_client_session>();
 
         std::vector<std::shared_ptr<client> > _result;
         _result.reserve(clients_.size());
@@ -149,6 +173,16 @@ namespace engine {
         return *_iterator;
     }
 
+    std::shared_ptr<session> state::get_route(const boost::uuids::uuid client_id) const {
+        std::shared_lock _lock(routes_mutex_);
+
+        const auto _iterator = routes_.find(client_id);
+        if (_iterator == routes_.end()) {
+            return nullptr;
+        }
+        return _iterator->second.lock();
+    }
+
     bool state::add_session(std::shared_ptr<session> session) {
         std::unique_lock _lock(sessions_mutex_);
         auto [_, _inserted] = sessions_.emplace(session->get_id(), session);
@@ -161,26 +195,130 @@ namespace engine {
     }
 
     bool state::add_client(const std::shared_ptr<client> &client) {
-        std::unique_lock _lock(clients_mutex_);
+        bool _inserted; {
+            std::unique_lock _lock(clients_mutex_);
 
-        auto &_index = clients_.get<clients_by_client_session>();
-        auto [_it, _inserted] =
-                _index.insert(client);
+            auto &_index = clients_.get<clients_by_client_session>();
+            _inserted = _index.insert(client).second;
+        }
+
+        if (_inserted) {
+            version_.fetch_add(1, std::memory_order_acq_rel);
+            add_route(client);
+        }
 
         return _inserted;
     }
 
     bool state::remove_client(const boost::uuids::uuid client_id) {
-        std::unique_lock _lock(clients_mutex_);
+        std::size_t _count; {
+            std::unique_lock _lock(clients_mutex_);
 
-        auto &_index = clients_.get<clients_by_client>();
-        auto [_begin, _end] = _index.equal_range(client_id);
+            auto &_index = clients_.get<clients_by_client>();
+            auto [_begin, _end] = _index.equal_range(client_id);
+
+            _count = std::distance(_begin, _end);
+            _index.erase(_begin, _end);
+        }
 
-        const std::size_t _count = std::distance(_begin, _end);
-        _index.erase(_begin, _end);
+        if (_count > 0)
+            version_.fetch_add(1, std::memory_order_acq_rel);
+
+        {
+            std::unique_lock _lock(routes_mutex_);
+            routes_.erase(client_id);
+        }
+
+        // Lo no confirmado espera a que el cliente retome desde otra conexión.
+        if (_count > 0) {
+            const auto _now = std::chrono::steady_clock::now();
+
+            std::scoped_lock _lock(reliable_buffers_mutex_);
+            if (const auto _it = reliable_buffers_.find(client_id); _it != reliable_buffers_.end()) {
+                _it->second->release(_now);
+                evict_reliable_buffers(_now);
+            }
+        }
         return _count;
     }
 
+    std::shared_ptr<reliable_buffer> state::enable_reliable(const boost::uuids::uuid client_id) {
+        const auto _now = std::chrono::steady_clock::now();
+
+        std::scoped_lock _lock(reliable_buffers_mutex_);
+
+        if (const auto _it = reliable_buffers_.find(client_id); _it != reliable_buffers_.end())
+            return _it->second;
+
+        evict_reliable_buffers(_now);
+
+        const auto _buffer = std::make_shared<reliable_buffer>(config_->reliable_messages_, config_->reliable_bytes_);
+        reliable_buffers_.emplace(client_id, _buffer);
+        return _buffer;
+    }
+
+    void state::evict_reliable_buffers(const std::chrono::steady_clock::time_point now) {
+        const auto _retention = std::chrono::seconds(config_->reliable_retention_);
+
+        // Se descartan los buffers huérfanos que ya no pueden retomarse.
+        std::erase_if(reliable_buffers_, [&](const auto &_entry) {
+            return _entry.second->is_expired(now, _retention);
+        });
+
+        std::vector<std::pair<std::chrono::steady_clock::time_point, boost::uuids::uuid> > _orphans;
+        for (const auto &[_client_id, _buffer]: reliable_buffers_) {
+            if (const auto _released_at = _buffer->get_released_at(); _released_at.has_value())
+                _orphans.emplace_back(_released_at.value(), _client_id);
+        }
+
+        if (_orphans.size() <= config_->reliable_orphans_)
+            return;
+
+        // Sin importar la retención la memoria queda acotada, los más antiguos son los menos probables de volver.
+        const auto _excess = _orphans.size() - config_->reliable_orphans_;
+        std::ranges::nth_element(_orphans, _orphans.begin() + static_cast<std::ptrdiff_t>(_excess));
+
+        for (std::size_t _i = 0; _i < _excess; ++_i)
+            reliable_buffers_.erase(_orphans[_i].second);
+    }
+
+    std::shared_ptr<reliable_buffer> state::resume_reliable(const boost::uuids::uuid client_id,
+                                                            const boost::uuids::uuid previous_id,
+                                                            const std::string_view token,
+                                                            const std::uint64_t sequence) {
+        const auto _now = std::chrono::steady_clock::now();
+        const auto _retention = std::chrono::seconds(config_->reliable_retention_);
+
+        std::shared_ptr<reliable_buffer> _buffer; {
+            std::scoped_lock _lock(reliable_buffers_mutex_);
+
+            // La conexión nueva ya tiene entregas propias sin confirmar, reemplazarlas las perdería.
+            if (reliable_buffers_.contains(client_id))
+                return nullptr;
+
+            const auto _it = reliable_buffers_.find(previous_id);
+            if (_it == reliable_buffers_.end() || !_it->second->is_token(token) ||
+                _it->second->is_expired(_now, _retention) || !_it->second->adopt())
+                return nullptr;
+
+            _buffer = std::move(_it->second);
+            reliable_buffers_.erase(_it);
+            reliable_buffers_.insert_or_assign(client_id, _buffer);
+        }
+
+        _buffer->confirm(sequence);
+        return _buffer;
+    }
+
+    std::shared_ptr<reliable_buffer> state::get_reliable_buffer(const boost::uuids::uuid client_id) const {
+        std::scoped_lock _lock(reliable_buffers_mutex_);
+
+        if (const auto _it = reliable_buffers_.find(client_id); _it != reliable_buffers_.end())
+            return _it->second;
+
+        return nullptr;
+    }
+
     bool state::subscribe(const boost::uuids::uuid &session_id, const boost::uuids::uuid &client_id,
                           const std::string &channel) {
         std::unique_lock _lock(subscriptions_mutex_);
@@ -191,6 +329,9 @@ namespace engine {
         auto [_it, _inserted] =
                 _index.insert(subscription{session_id, client_id, channel});
 
+        if (_inserted)
+            version_.fetch_add(1, std::memory_order_acq_rel);
+
         return _inserted;
     }
 
@@ -209,9 +350,89 @@ namespace engine {
             return false;
 
         _index.erase(_iterator);
+        version_.fetch_add(1, std::memory_order_acq_rel);
         return true;
     }
 
+    std::vector<bool> state::subscribe(const std::vector<subscription> &subscriptions) {
+        std::vector<bool> _inserted(subscriptions.size(), false);
+
+        // El orden se resuelve fuera del lock, dentro solo se recorre el índice hacia adelante.
+        const auto _order = get_subscriptions_order(subscriptions);
+
+        std::unique_lock _lock(subscriptions_mutex_);
+
+        auto &_index =
+                subscriptions_.get<subscriptions_by_session_client_channel>();
+
+        auto _hint = _index.end();
+        bool _located = false;
+        for (const auto _position: _order) {
+            const auto &_subscription = subscriptions[_position];
+            const auto _key = std::tie(_subscription.session_id_, _subscription.client_id_, _subscription.channel_);
+
+            // Con la entrada ordenada el sucesor del último insertado suele ser la posición correcta.
+            if (!_located || (_hint != _index.end() &&
+                              std::tie(_hint->session_id_, _hint->client_id_, _hint->channel_) < _key)) {
+                _hint = _index.lower_bound(boost::make_tuple(_subscription.session_id_, _subscription.client_id_,
+                                                             _subscription.channel_));
+                _located = true;
+            }
+
+            const auto _size = _index.size();
+            _hint = std::next(_index.insert(_hint, _subscription));
+            _inserted[_position] = _index.size() != _size;
+        }
+
+        if (std::ranges::find(_inserted, true) != _inserted.end())
+            version_.fetch_add(1, std::memory_order_acq_rel);
+
+        return _inserted;
+    }
+
+    std::vector<bool> state::unsubscribe(const std::vector<subscription> &subscriptions) {
+        std::vector<bool> _removed(subscriptions.size(), false);
+
+        const auto _order = get_subscriptions_order(subscriptions);
+
+        std::unique_lock _lock(subscriptions_mutex_);
+
+        auto &_index =
+                subscriptions_.get<subscriptions_by_session_client_channel>();
+
+        for (const auto _position: _order) {
+            const auto &_subscription = subscriptions[_position];
+            const auto _iterator = _index.find(
+                boost::make_tuple(_subscription.session_id_, _subscription.client_id_, _subscription.channel_)
+            );
+
+            if (_iterator == _index.end())
+                continue;
+
+            _index.erase(_iterator);
+            _removed[_position] = true;
+        }
+
+        if (std::ranges::find(_removed, true) != _removed.end())
+            version_.fetch_add(1, std::memory_order_acq_rel);
+
+        return _removed;
+    }
+
+    std::vector<std::size_t> state::get_subscriptions_order(const std::vector<subscription> &subscriptions) {
+        std::vector<std::size_t> _order(subscriptions.size());
+        std::iota(_order.begin(), _order.end(), 0);
+
+        std::ranges::sort(_order, [&subscriptions](const std::size_t left, const std::size_t right) {
+            const auto &_left = subscriptions[left];
+            const auto &_right = subscriptions[right];
+            return std::tie(_left.session_id_, _left.client_id_, _left.channel_) <
+                   std::tie(_right.session_id_, _right.client_id_, _right.channel_);
+        });
+
+        return _order;
+    }
+
     bool state::is_subscribed(const boost::uuids::uuid &client_id,
                               const std::string &channel) {
         std::shared_lock _lock(subscriptions_mutex_);
@@ -227,7 +448,7 @@ namespace engine {
                                              const boost::json::object &data) const {
         const auto _data = make_broadcast_request_object(request, client_id, data);
 
-        return send_to_sessions(_data);
+        return send_to_sessions(_data, to_string(client_id));
     }
 
     std::size_t state::broadcast_to_clients(const request &request, const boost::uuids::uuid session_id,
@@ -255,11 +476,11 @@ namespace engine {
         }
 
         auto _sessions = get_sessions();
-        auto const _message = std::make_shared<std::string const>(serialize(data));
+        auto const _message = make_session_message(data);
 
         for (const auto &_session: _sessions) {
             if (_receivers.contains(_session->get_id()))
-                _session->send(_message);
+                _session->send(_message, channel);
         }
 
         return _receivers.size();
@@ -275,12 +496,162 @@ namespace engine {
 
     std::size_t state::publish_to_clients(const request &request, const boost::uuids::uuid session_id,
                                           const boost::uuids::uuid client_id, const std::string &channel,
-                                          const boost::json::object &data) const {
-        const auto _data = std::make_shared<boost::json::object>(
-            make_publish_request_object(request, client_id, channel, data)
-        );
+                                          const boost::json::object &data) {
+        auto _data = make_publish_request_object(request, client_id, channel, data);
 
-        return send_to_others_clients(_data, session_id, client_id);
+        const auto _history = get_history(channel, true);
+        const auto _log = get_log(channel, _history == nullptr);
+        if (_history == nullptr && _log == nullptr) {
+            const auto _message = std::make_shared<std::string const>(serialize(_data));
+            if (config_->last_value_channels_ > 0)
+                last_values_.store(channel, _message, config_->last_value_channels_);
+
+            return send_to_others_clients(_message, session_id, client_id, std::make_shared<std::string const>(channel));
+        }
+
+        // Se agrega y se entrega bajo el mismo bloqueo para que una repetición no se intercale con mensajes vivos,
+        // sin historial el log numera por sí mismo.
+        std::scoped_lock _lock(_history != nullptr ? _history->get_mutex() : _log->get_mutex());
+
+        const auto _timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+        const auto _sequence = _history != nullptr ? _history->get_next_sequence() : _log->get_next_sequence();
+        auto &_params = _data.at("params").as_object();
+        _params["sequence"] = _sequence;
+        _params["timestamp"] = _timestamp;
+
+        const auto _message = std::make_shared<std::string const>(serialize(_data));
+        if (_history != nullptr)
+            _history->append(_timestamp, *_message);
+
+        if (_log != nullptr)
+            _log->append(_sequence, _timestamp, *_message);
+
+        if (config_->last_value_channels_ > 0)
+            last_values_.store(channel, _message, config_->last_value_channels_);
+
+        return send_to_others_clients(_message, session_id, client_id, std::make_shared<std::string const>(channel));
+    }
+
+    bool state::allow_publish(const std::string_view channel, const std::int64_t now) {
+        const token_bucket _bucket{config_->channel_rate_limit_, config_->rate_limit_burst_};
+        if (!_bucket.is_enabled())
+            return true;
+
+        {
+            std::shared_lock _lock(channel_limits_mutex_);
+            if (const auto _it = channel_limits_.find(channel); _it != channel_limits_.end())
+                return _bucket.consume(*_it->second, now);
+        }
+
+        std::unique_lock _lock(channel_limits_mutex_);
+
+        // Cualquier cliente puede inventar canales, los baldes ya recargados se descartan sin perder nada.
+        if (channel_limits_.size() >= channel_limits_sweep_at_) {
+            std::erase_if(channel_limits_, [now](const auto &_item) {
+                return _item.second->load(std::memory_order_relaxed) <= now;
+            });
+            channel_limits_sweep_at_ = std::max<std::size_t>(1024, channel_limits_.size() * 2);
+        }
+
+        auto _it = channel_limits_.find(channel);
+        if (_it == channel_limits_.end())
+            _it = channel_limits_.emplace(std::string(channel), std::make_unique<std::atomic<std::int64_t> >(0)).first;
+
+        return _bucket.consume(*_it->second, now);
+    }
+
+    std::size_t state::get_channel_limits_size() const {
+        std::shared_lock _lock(channel_limits_mutex_);
+        return channel_limits_.size();
+    }
+
+    bool state::is_conflated_channel(const std::string_view channel) const {
+        if (config_->conflated_channels_.empty())
+            return false;
+
+        // La lista se conoce recién después de configurar el servidor, se interpreta al primer uso.
+        std::call_once(conflated_channels_once_, [this] {
+            std::string_view _list = config_->conflated_channels_;
+            while (!_list.empty()) {
+                const auto _end = _list.find(',');
+                if (const auto _name = _list.substr(0, _end); !_name.empty())
+                    conflated_channels_.emplace(_name);
+
+                if (_end == std::string_view::npos)
+                    break;
+                _list.remove_prefix(_end + 1);
+            }
+        });
+
+        return conflated_channels_.contains(channel);
+    }
+
+    bool state::send_last_value(const boost::uuids::uuid client_id, const std::string &channel) const {
+        if (config_->last_value_channels_ == 0)
+            return false;
+
+        const auto _message = last_values_.load(channel);
+        if (!_message)
+            return false;
+
+        const auto _client = get_client(client_id);
+        if (!_client.has_value())
+            return false;
+
+        // Va en la misma clase que el ack de la suscripción para que éste no lo adelante.
+        _client.value()->send(_message, control);
+        return true;
+    }
+
+    std::size_t state::replay(const boost::uuids::uuid client_id, const std::string &channel,
+                              const std::optional<std::uint64_t> sequence,
+                              const std::optional<std::int64_t> timestamp) {
+        const auto _client = get_client(client_id);
+        if (!_client.has_value())
+            return 0;
+
+        // Una repetición nunca crea historial ni log, sólo lee lo que ya existe en memoria o en disco.
+        const auto _history = get_history(channel, false);
+        const auto _log = get_log(channel, false);
+        if (_history == nullptr && _log == nullptr)
+            return 0;
+
+        std::vector<std::shared_ptr<std::string const> > _messages; {
+            std::unique_lock<std::mutex> _lock;
+            if (_history != nullptr)
+                _lock = std::unique_lock(_history->get_mutex());
+
+            if (_log != nullptr) {
+                const auto _collect = [&_messages](const publish_log::record &record) {
+                    _messages.push_back(std::make_shared<std::string const>(record.data_));
+                };
+
+                const auto _limit = config_->publish_log_replay_bytes_;
+                if (sequence.has_value())
+                    _log->read_since_sequence(sequence.value(), _collect, _limit);
+                else
+                    _log->read_since_timestamp(timestamp.value_or(0), _collect, _limit);
+            } else {
+                const auto _now = std::chrono::system_clock::now().time_since_epoch().count();
+                _messages = sequence.has_value()
+                                ? _history->get_since_sequence(sequence.value(), _now)
+                                : _history->get_since_timestamp(timestamp.value_or(0), _now);
+            }
+        }
+
+        // Se envía fuera del bloqueo para no frenar las publicaciones del canal, la secuencia de cada envelope
+        // ordena los que se crucen con mensajes vivos. Va en la misma clase que el ack de la suscripción para que
+        // éste no la adelante.
+        for (const auto &_message: _messages)
+            _client.value()->send(_message, control);
+
+        return _messages.size();
+    }
+
+    std::size_t state::batch_to_sessions(const request &request, const boost::json::array &requests) const {
+        const auto _data = make_batch_request_object(request, requests);
+
+        return send_to_sessions(_data);
     }
 
     std::size_t state::join_to_sessions(const boost::uuids::uuid client_id) const {
@@ -302,77 +673,170 @@ namespace engine {
         return send_to_sessions(_data);
     }
 
+    std::size_t state::subscribe_to_sessions(const request &request, const boost::uuids::uuid client_id,
+                                             const std::vector<std::string> &channels) const {
+        const auto _data = make_subscribe_request_object(request, client_id, channels);
+
+        return send_to_sessions(_data);
+    }
+
     bool state::push_client(const std::shared_ptr<client> &client) {
-        std::unique_lock _lock(clients_mutex_);
+        bool _inserted; {
+            std::unique_lock _lock(clients_mutex_);
 
-        auto &_index = clients_.get<clients_by_client_session>();
-        auto [_it, _inserted] =
-                _index.insert(client);
+            auto &_index = clients_.get<clients_by_client_session>();
+            _inserted = _index.insert(client).second;
+        }
+
+        if (_inserted) {
+            version_.fetch_add(1, std::memory_order_acq_rel);
+            add_route(client);
+        }
 
         return _inserted;
     }
 
     void state::sync(const std::shared_ptr<session> &session, const bool registered) {
-        if (!registered) {
-            for (const auto &_session: get_sessions()) {
-                // Si el identificador de la sesión en iteración es igual al identificador del estado entonces
-                // implicaría que no debería ser considerada para ser reportada a la sesión porque ya está conectada
-                // a esta instancia.
-                const auto _is_state = _session->get_id() == get_id();
+        // En topología de árbol no se anuncian las demás sesiones, el nuevo nodo solo conoce a su padre.
+        // Los clientes y suscripciones no se envían aquí, se intercambian por digest y solo los buckets distintos.
+        if (registered || is_relay())
+            return;
 
-                // Sí el identificador de la sesión en iteración es igual al identificador de la sesión
-                // implicaría que no debería ser considerada para ser reportada a la sesión porque es ella misma.
-                const auto _is_same = _session->get_id() == session->get_id();
+        for (const auto &_session: get_sessions()) {
+            // Si el identificador de la sesión en iteración es igual al identificador del estado entonces
+            // implicaría que no debería ser considerada para ser reportada a la sesión porque ya está conectada
+            // a esta instancia.
+            const auto _is_state = _session->get_id() == get_id();
 
-                // Sí la sesión en iteración no está registrada entonces está en proceso a ser registrada.
-                const auto _is_unregistered = !_session->get_registered();
+            // Sí el identificador de la sesión en iteración es igual al identificador de la sesión
+            // implicaría que no debería ser considerada para ser reportada a la sesión porque es ella misma.
+            const auto _is_same = _session->get_id() == session->get_id();
 
-                if (_is_state || _is_same || _is_unregistered)
-                    continue;
+            // Sí la sesión en iteración no está registrada entonces está en proceso a ser registrada.
+            const auto _is_unregistered = !_session->get_registered();
 
-                boost::json::object _data = {
-                    {"action", "session"},
-                    {"transaction_id", to_string(boost::uuids::random_generator()())},
-                    {
-                        "params", {
-                            {"host", _session->get_host()},
-                            {"sessions_port", _session->get_sessions_port()},
-                            {"clients_port", _session->get_clients_port()},
-                        }
+            if (_is_state || _is_same || _is_unregistered)
+                continue;
+
+            boost::json::object _data = {
+                {"action", "session"},
+                {"transaction_id", to_string(boost::uuids::random_generator()())},
+                {
+                    "params", {
+                        {"host", _session->get_host()},
+                        {"sessions_port", _session->get_sessions_port()},
+                        {"clients_port", _session->get_clients_port()},
                     }
-                };
+                }
+            };
+
+            auto const _message = std::make_shared<std::string const>(serialize(_data));
+            session->send(_message);
+        }
+    }
+
+    std::int64_t state::get_version() const {
+        return version_.load(std::memory_order_acquire);
+    }
 
-                auto const _message = std::make_shared<std::string const>(serialize(_data));
-                session->send(_message);
+    digest state::get_digest(const boost::uuids::uuid session_id) const {
+        digest _digest; {
+            std::shared_lock _lock(clients_mutex_);
+            for (const auto &_client: clients_.get<clients_by_session>()) {
+                if (is_advertised(_client->get_session_id(), session_id))
+                    _digest.add_client(_client->get_id());
             }
         } {
-            std::shared_lock _lock(clients_mutex_);
+            std::shared_lock _lock(subscriptions_mutex_);
+            for (const auto &_subscription: subscriptions_.get<subscriptions_by_session>()) {
+                if (is_advertised(_subscription.session_id_, session_id))
+                    _digest.add_subscription(_subscription.client_id_, _subscription.channel_);
+            }
+        }
+        return _digest;
+    }
 
+    digest state::get_view(const boost::uuids::uuid session_id) const {
+        digest _digest; {
+            std::shared_lock _lock(clients_mutex_);
             const auto &_index = clients_.get<clients_by_session>();
+            for (auto [_it, _end] = _index.equal_range(session_id); _it != _end; ++_it)
+                _digest.add_client((*_it)->get_id());
+        } {
+            std::shared_lock _lock(subscriptions_mutex_);
+            const auto &_index = subscriptions_.get<subscriptions_by_session>();
+            for (auto [_it, _end] = _index.equal_range(session_id); _it != _end; ++_it)
+                _digest.add_subscription(_it->client_id_, _it->channel_);
+        }
+        return _digest;
+    }
+
+    std::size_t state::reconcile(const std::shared_ptr<session> &session, const digest &remote,
+                                 const std::int64_t version) {
+        // La versión coincide con la última conciliada, nada cambió en la instancia remota.
+        if (version >= 0 && version == session->get_peer_version())
+            return 0;
 
-            for (auto [_it, _end] = _index.equal_range(get_id()); _it != _end; ++_it) {
-                const auto _client = *_it;
+        const auto _buckets = get_view(session->get_id()).compare(remote);
+        if (_buckets.empty()) {
+            session->set_peer_version(version);
+            return 0;
+        }
 
-                boost::json::object _data = {
-                    {"action", "join"},
-                    {"transaction_id", to_string(boost::uuids::random_generator()())},
-                    {
-                        "params", {
-                            {"client_id", to_string(_client->get_id())},
-                        }
-                    }
-                };
+        // Se descarta lo conocido en los buckets distintos y se solicita su contenido a la instancia remota.
+        drop_buckets(session->get_id(), _buckets);
+        session->set_peer_version(-1);
+
+        boost::json::array _requested;
+        _requested.reserve(_buckets.size());
+        for (const auto _bucket: _buckets)
+            _requested.emplace_back(_bucket);
+
+        const boost::json::object _data = {
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "resync"},
+            {
+                "params", {
+                    {"buckets", _requested},
+                }
+            }
+        };
+
+        session->send(std::make_shared<std::string const>(serialize(_data)));
+
+        LOG_INFO("state_id=[{}] action=[reconcile] session_id=[{}] buckets=[{}]", to_string(id_),
+                 to_string(session->get_id()), _buckets.size());
+
+        return _buckets.size();
+    }
+
+    std::size_t state::send_buckets(const std::shared_ptr<session> &session,
+                                    const std::vector<std::size_t> &buckets) const {
+        std::array<bool, digest::buckets> _requested{};
+        for (const auto _bucket: buckets) {
+            if (_bucket < digest::buckets)
+                _requested[_bucket] = true;
+        }
+
+        std::size_t _count = 0; {
+            std::shared_lock _lock(clients_mutex_);
+
+            for (const auto &_client: clients_.get<clients_by_session>()) {
+                if (!is_advertised(_client->get_session_id(), session->get_id()) ||
+                    !_requested[digest::get_bucket(_client->get_id())])
+                    continue;
 
-                auto const _message = std::make_shared<std::string const>(serialize(_data));
-                session->send(_message);
+                session->send(std::make_shared<std::string const>(
+                    serialize(make_join_request_object(_client->get_id()))));
+                _count++;
             }
         } {
             std::shared_lock _lock(subscriptions_mutex_);
 
-            const auto &_index = subscriptions_.get<subscriptions_by_session>();
-
-            for (auto [_it, _end] = _index.equal_range(get_id()); _it != _end; ++_it) {
-                auto _subscription = *_it;
+            for (const auto &_subscription: subscriptions_.get<subscriptions_by_session>()) {
+                if (!is_advertised(_subscription.session_id_, session->get_id()) ||
+                    !_requested[digest::get_bucket(_subscription.client_id_)])
+                    continue;
 
                 boost::json::object _data = {
                     {"action", "subscribe"},
@@ -385,89 +849,733 @@ namespace engine {
                     }
                 };
 
-                auto const _message = std::make_shared<std::string const>(serialize(_data));
-                session->send(_message);
+                session->send(std::make_shared<std::string const>(serialize(_data)));
+                _count++;
             }
         }
-    }
 
-    boost::asio::io_context &state::get_ioc() {
-        return ioc_;
+        return _count;
     }
 
-    std::size_t state::unsubscribe_to_sessions(const request &request, const boost::uuids::uuid client_id,
-                                               const std::string &channel) const {
-        const auto _data = make_unsubscribe_request_object(request, client_id, channel);
-
-        return send_to_sessions(_data);
-    }
+    void state::retain_state_of_session(const boost::uuids::uuid id, const boost::uuids::uuid node_id,
+                                        const std::int64_t version) {
+        const auto _retention = std::chrono::seconds(config_->peer_retention_);
+        if (_retention.count() == 0 || node_id.is_nil()) {
+            remove_state_of_session(id);
+            return;
+        }
 
-    void state::remove_state_of_session(const boost::uuids::uuid id) { {
+        retained_state _retained{.version_ = version, .retained_at_ = std::chrono::steady_clock::now()}; {
             std::unique_lock _lock(clients_mutex_);
 
             auto &_index = clients_.get<clients_by_session>();
             auto [_begin, _end] = _index.equal_range(id);
 
+            for (auto _it = _begin; _it != _end; ++_it)
+                _retained.clients_.push_back((*_it)->get_id());
+
             _index.erase(_begin, _end);
+        } {
+            std::unique_lock _lock(routes_mutex_);
+
+            for (const auto &_client_id: _retained.clients_)
+                routes_.erase(_client_id);
         } {
             std::unique_lock _lock(subscriptions_mutex_);
 
             auto &_index = subscriptions_.get<subscriptions_by_session>();
             auto [_begin, _end] = _index.equal_range(id);
 
+            for (auto _it = _begin; _it != _end; ++_it)
+                _retained.subscriptions_.emplace_back(_it->client_id_, _it->channel_);
+
             _index.erase(_begin, _end);
         }
-    }
 
-    void state::send_to_session(const boost::uuids::uuid session_id, const boost::uuids::uuid from_client_id,
-                                const boost::uuids::uuid to_client_id, const boost::json::object &payload) const {
-        auto _sessions = get_sessions();
+        version_.fetch_add(1, std::memory_order_acq_rel);
 
-        const boost::json::object _data = {
-            {"transaction_id", to_string(boost::uuids::random_generator()())},
-            {"action", "send"},
-            {
-                "params", {
-                    {"from_client_id", to_string(from_client_id)},
-                    {"to_client_id", to_string(to_client_id)},
-                    {"payload", payload},
-                }
-            }
-        };
+        std::scoped_lock _lock(retained_mutex_);
 
-        auto const _message = std::make_shared<std::string const>(serialize(_data));
+        // Se descartan los estados retenidos que ya expiraron.
+        std::erase_if(retained_, [&](const auto &_entry) {
+            return _entry.second.retained_at_ + _retention < _retained.retained_at_;
+        });
 
-        for (const auto &_session: _sessions) {
-            if (_session->get_id() == session_id) {
-                _session->send(_message);
-            }
-        }
+        retained_.insert_or_assign(node_id, std::move(_retained));
     }
 
-    std::shared_ptr<config> state::get_config() {
-        return config_;
-    }
+    std::int64_t state::adopt_state_of_session(const boost::uuids::uuid id, const boost::uuids::uuid node_id) {
+        retained_state _retained; {
+            std::scoped_lock _lock(retained_mutex_);
 
-    boost::asio::ssl::context & state::get_session_listener_ssl_context() {
-        return session_listener_ssl_context_;
-    }
+            const auto _iterator = retained_.find(node_id);
+            if (_iterator == retained_.end())
+                return -1;
 
-    boost::asio::ssl::context & state::get_session_ssl_context() {
-        return session_ssl_context_;
-    }
+            _retained = std::move(_iterator->second);
+            retained_.erase(_iterator);
+        }
 
-    boost::asio::ssl::context & state::get_client_listener_ssl_context() {
-        return client_listener_ssl_context_;
-    }
+        if (_retained.retained_at_ + std::chrono::seconds(config_->peer_retention_) < std::chrono::steady_clock::now())
+            return -1;
 
-    boost::asio::ssl::context & state::get_client_ssl_context() {
+        for (const auto &_client_id: _retained.clients_)
+            add_client(std::make_shared<client>(id, shared_from_this(), _client_id));
+
+        std::vector<subscription> _subscriptions;
+        _subscriptions.reserve(_retained.subscriptions_.size());
+        for (const auto &[_client_id, _channel]: _retained.subscriptions_)
+            _subscriptions.push_back(subscription{id, _client_id, _channel});
+
+        subscribe(_subscriptions);
+
+        LOG_INFO("state_id=[{}] action=[adopt] session_id=[{}] node_id=[{}] clients=[{}] subscriptions=[{}]",
+                 to_string(id_), to_string(id), to_string(node_id), _retained.clients_.size(),
+                 _retained.subscriptions_.size());
+
+        return _retained.version_;
+    }
+
+    std::size_t state::load_snapshot() {
+        if (config_->snapshot_path_.empty() || config_->peer_retention_ == 0)
+            return 0;
+
+        auto _peers = read_snapshot(config_->snapshot_path_);
+        const auto _count = _peers.size(); {
+            std::scoped_lock _lock(retained_mutex_);
+            for (auto &[_node_id, _retained]: _peers)
+                retained_.insert_or_assign(_node_id, std::move(_retained));
+        }
+
+        LOG_INFO("state_id=[{}] action=[load_snapshot] path=[{}] peers=[{}]", to_string(id_),
+                 config_->snapshot_path_, _count);
+
+        return _count;
+    }
+
+    bool state::save_snapshot() const {
+        if (config_->snapshot_path_.empty())
+            return false;
+
+        const auto _now = std::chrono::steady_clock::now();
+        const auto _retention = std::chrono::seconds(config_->peer_retention_);
+
+        snapshot _peers; {
+            std::scoped_lock _lock(retained_mutex_);
+            for (const auto &[_node_id, _retained]: retained_) {
+                if (_retained.retained_at_ + _retention >= _now)
+                    _peers.emplace(_node_id, _retained);
+            }
+        }
+
+        for (const auto &_session: get_sessions()) {
+            // Cada par se guarda una sola vez, por su carril principal.
+            if (!_session->get_registered() || _session->get_lane() != 0 || _session->get_node_id().is_nil())
+                continue;
+
+            retained_state _retained{.version_ = _session->get_peer_version()}; {
+                std::shared_lock _lock(clients_mutex_);
+                const auto &_index = clients_.get<clients_by_session>();
+                for (auto [_it, _end] = _index.equal_range(_session->get_id()); _it != _end; ++_it)
+                    _retained.clients_.push_back((*_it)->get_id());
+            } {
+                std::shared_lock _lock(subscriptions_mutex_);
+                const auto &_index = subscriptions_.get<subscriptions_by_session>();
+                for (auto [_it, _end] = _index.equal_range(_session->get_id()); _it != _end; ++_it)
+                    _retained.subscriptions_.emplace_back(_it->client_id_, _it->channel_);
+            }
+
+            _peers.insert_or_assign(_session->get_node_id(), std::move(_retained));
+        }
+
+        return write_snapshot(config_->snapshot_path_, _peers);
+    }
+
+    void state::start_snapshots() {
+        if (config_->snapshot_path_.empty() || config_->snapshot_interval_ == 0)
+            return;
+
+        snapshot_timer_.expires_after(std::chrono::milliseconds(config_->snapshot_interval_));
+        snapshot_timer_.async_wait([_state = weak_from_this()](const boost::system::error_code &ec) {
+            if (const auto _instance = _state.lock())
+                _instance->on_snapshot_timer(ec);
+        });
+    }
+
+    void state::on_snapshot_timer(const boost::system::error_code &ec) {
+        if (ec)
+            return;
+
+        if (!save_snapshot())
+            LOG_INFO("state_id=[{}] action=[save_snapshot] path=[{}] status=[failed]", to_string(id_),
+                     config_->snapshot_path_);
+
+        start_snapshots();
+    }
+
+    boost::asio::io_context &state::get_ioc() {
+        return ioc_;
+    }
+
+    boost::asio::io_context &state::get_handshake_ioc() {
+        return handshake_ioc_;
+    }
+
+    worker_pool &state::get_workers() {
+        return workers_;
+    }
+
+    boost::asio::io_context &state::get_log_ioc() {
+        return log_ioc_;
+    }
+
+    std::size_t state::unsubscribe_to_sessions(const request &request, const boost::uuids::uuid client_id,
+                                               const std::string &channel) const {
+        const auto _data = make_unsubscribe_request_object(request, client_id, channel);
+
+        return send_to_sessions(_data);
+    }
+
+    std::size_t state::unsubscribe_to_sessions(const request &request, const boost::uuids::uuid client_id,
+                                               const std::vector<std::string> &channels) const {
+        const auto _data = make_unsubscribe_request_object(request, client_id, channels);
+
+        return send_to_sessions(_data);
+    }
+
+    void state::remove_state_of_session(const boost::uuids::uuid id) {
+        std::vector<boost::uuids::uuid> _clients; {
+            std::unique_lock _lock(clients_mutex_);
+
+            auto &_index = clients_.get<clients_by_session>();
+            auto [_begin, _end] = _index.equal_range(id);
+
+            for (auto _it = _begin; _it != _end; ++_it)
+                _clients.push_back((*_it)->get_id());
+
+            _index.erase(_begin, _end);
+        } {
+            std::unique_lock _lock(routes_mutex_);
+
+            for (const auto &_client_id: _clients)
+                routes_.erase(_client_id);
+        } {
+            std::unique_lock _lock(subscriptions_mutex_);
+
+            auto &_index = subscriptions_.get<subscriptions_by_session>();
+            auto [_begin, _end] = _index.equal_range(id);
+
+            _index.erase(_begin, _end);
+        }
+    }
+
+    void state::send_to_session(const boost::uuids::uuid session_id, const boost::uuids::uuid from_client_id,
+                                const boost::uuids::uuid to_client_id, const boost::json::object &payload) const {
+        // La ruta se resuelve antes de construir el mensaje, sin recorrer las sesiones.
+        auto _session = get_route(to_client_id);
+        if (!_session || _session->get_id() != session_id) {
+            const auto _fallback = get_session(session_id);
+            if (!_fallback.has_value())
+                return;
+
+            _session = _fallback.value();
+        }
+
+        const boost::json::object _data = {
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "send"},
+            {
+                "params", {
+                    {"from_client_id", to_string(from_client_id)},
+                    {"to_client_id", to_string(to_client_id)},
+                    {"payload", payload},
+                }
+            }
+        };
+
+        auto const _message = make_session_message(_data);
+        _session->send(_message, to_string(to_client_id));
+    }
+
+    bool state::is_relay() const {
+        return config_->topology_ == "tree";
+    }
+
+    bool state::is_loop(const boost::json::object &data) const {
+        return data.contains("origin_id") && data.at("origin_id").is_string() &&
+               data.at("origin_id").as_string() == to_string(id_);
+    }
+
+    std::size_t state::relay(const request &request, const std::string_view key) const {
+        if (!is_relay())
+            return 0;
+
+        const auto _message = make_relay_message(request);
+        if (!_message)
+            return 0;
+
+        std::size_t _count = 0;
+
+        // Se reenvía a todas las sesiones vecinas con excepción de la que entregó el mensaje.
+        for (const auto &_session: get_sessions()) {
+            if (_session->get_id() == request.entity_id_)
+                continue;
+
+            if (key.empty())
+                _session->send(_message);
+            else
+                _session->send(_message, key);
+            _count++;
+        }
+
+        return _count;
+    }
+
+    std::size_t state::relay_to_subscribed(const request &request, const std::string &channel) const {
+        if (!is_relay())
+            return 0;
+
+        std::unordered_set<boost::uuids::uuid> _receivers; {
+            std::shared_lock _lock(subscriptions_mutex_);
+            const auto &_idx = subscriptions_.get<subscriptions_by_channel>();
+            for (auto [_it, _end] = _idx.equal_range(channel); _it != _end; ++_it) {
+                if (_it->session_id_ != request.entity_id_ && _it->session_id_ != id_)
+                    _receivers.insert(_it->session_id_);
+            }
+        }
+
+        if (_receivers.empty())
+            return 0;
+
+        const auto _message = make_relay_message(request);
+        if (!_message)
+            return 0;
+
+        for (const auto &_session: get_sessions()) {
+            if (_receivers.contains(_session->get_id()))
+                _session->send(_message, channel);
+        }
+
+        return _receivers.size();
+    }
+
+    bool state::relay_to_session(const request &request, const boost::uuids::uuid session_id,
+                                 const std::string_view key) const {
+        if (!is_relay() || session_id == request.entity_id_)
+            return false;
+
+        const auto _session = get_session(session_id);
+        if (!_session.has_value())
+            return false;
+
+        const auto _message = make_relay_message(request);
+        if (!_message)
+            return false;
+
+        _session.value()->send(_message, key);
+        return true;
+    }
+
+    bool state::is_duplicate(const boost::json::object &data) {
+        if (config_->dedup_ttl_ == 0)
+            return false;
+
+        const auto *_action = data.if_contains("action");
+        if (_action == nullptr || !_action->is_string())
+            return false;
+
+        const auto &_name = _action->as_string();
+        if (_name != "publish" && _name != "broadcast" && _name != "send")
+            return false;
+
+        const auto *_transaction_id = data.if_contains("transaction_id");
+        if (_transaction_id == nullptr || !_transaction_id->is_string())
+            return false;
+
+        auto _key = dedup_window::make_key(_transaction_id->as_string());
+        if (!_key.has_value())
+            return false;
+
+        // El identificador de transacción lo elige el cliente, se combina con la acción, el canal y el cliente
+        // para que sólo colisionen reenvíos del mismo mensaje.
+        std::uint64_t _scope = 14695981039346656037ull;
+        const auto _mix = [&_scope](const std::string_view value) {
+            for (const auto _character: value) {
+                _scope ^= static_cast<unsigned char>(_character);
+                _scope *= 1099511628211ull;
+            }
+            _scope ^= 0xff;
+            _scope *= 1099511628211ull;
+        };
+
+        _mix(_name);
+
+        if (const auto *_params = data.if_contains("params"); _params != nullptr && _params->is_object()) {
+            const auto &_object = _params->as_object();
+
+            if (const auto *_channel = _object.if_contains("channel"); _channel != nullptr && _channel->is_string())
+                _mix(_channel->as_string());
+
+            if (const auto *_client_id = _object.if_contains("client_id");
+                _client_id != nullptr && _client_id->is_string()) {
+                if (const auto _client_key = dedup_window::make_key(_client_id->as_string())) {
+                    _key->high_ ^= _client_key->low_;
+                    _key->low_ ^= _client_key->high_;
+                }
+            }
+        }
+
+        _key->high_ ^= _scope;
+        _key->low_ ^= std::rotl(_scope, 32);
+
+        return !get_dedup().insert(_key.value());
+    }
+
+    std::uint64_t state::get_dedup_hits() const {
+        return get_dedup().get_hits();
+    }
+
+    std::uint64_t state::get_dedup_misses() const {
+        return get_dedup().get_misses();
+    }
+
+    dedup_window &state::get_dedup() const {
+        // La capacidad se conoce recién después de configurar el servidor, la ventana se reserva al primer uso.
+        std::call_once(dedup_once_, [this] {
+            dedup_ = std::make_unique<dedup_window>(config_->dedup_capacity_,
+                                                    std::chrono::milliseconds(std::max<std::size_t>(
+                                                        config_->dedup_ttl_, 1)));
+        });
+
+        return *dedup_;
+    }
+
+    void state::count_message() {
+        messages_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void state::add_queued(const std::int64_t count) {
+        queued_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void state::record_queue_latency(const priority priority, const std::chrono::steady_clock::duration wait) {
+        const auto _wait = static_cast<std::uint64_t>(
+            std::max<std::int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(wait).count(), 0));
+
+        queue_latency_count_[priority].fetch_add(1, std::memory_order_relaxed);
+        queue_latency_total_[priority].fetch_add(_wait, std::memory_order_relaxed);
+
+        auto _max = queue_latency_max_[priority].load(std::memory_order_relaxed);
+        while (_wait > _max && !queue_latency_max_[priority].compare_exchange_weak(
+                   _max, _wait, std::memory_order_relaxed)) {
+        }
+    }
+
+    queue_latency state::get_queue_latency(const priority priority) const {
+        return {
+            .count_ = queue_latency_count_[priority].load(std::memory_order_relaxed),
+            .total_ = queue_latency_total_[priority].load(std::memory_order_relaxed),
+            .max_ = queue_latency_max_[priority].load(std::memory_order_relaxed),
+        };
+    }
+
+    load state::get_load() const {
+        std::size_t _clients; {
+            std::shared_lock _lock(clients_mutex_);
+            _clients = clients_.get<clients_by_session>().count(id_);
+        }
+
+        return load{
+            .clients_ = _clients,
+            .rate_ = rate_.load(std::memory_order_acquire),
+            .queued_ = static_cast<std::size_t>(std::max<std::int64_t>(queued_.load(std::memory_order_relaxed), 0)),
+            .draining_ = is_draining(),
+        };
+    }
+
+    void state::start_load_reports() {
+        if (config_->load_report_interval_ == 0)
+            return;
+
+        reported_at_ = std::chrono::steady_clock::now();
+
+        load_timer_.expires_after(std::chrono::milliseconds(config_->load_report_interval_));
+        load_timer_.async_wait([_state = weak_from_this()](const boost::system::error_code &ec) {
+            if (const auto _instance = _state.lock())
+                _instance->on_load_timer(ec);
+        });
+    }
+
+    void state::on_load_timer(const boost::system::error_code &ec) {
+        if (ec)
+            return;
+
+        const auto _now = std::chrono::steady_clock::now();
+        const auto _messages = messages_.load(std::memory_order_relaxed);
+        const auto _elapsed = std::chrono::duration<double>(_now - reported_at_).count();
+
+        if (_elapsed > 0)
+            rate_.store(static_cast<double>(_messages - reported_messages_) / _elapsed, std::memory_order_release);
+
+        reported_messages_ = _messages;
+
+        const auto [_clients, _rate, _queued, _draining] = get_load();
+        const boost::json::object _data = {
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "load"},
+            {
+                "params", {
+                    {"clients", _clients},
+                    {"rate", _rate},
+                    {"queued", _queued},
+                    {"draining", _draining},
+                }
+            }
+        };
+
+        const auto _message = std::make_shared<std::string const>(serialize(_data));
+        for (const auto &_session: get_sessions()) {
+            if (_session->get_registered())
+                _session->send(_message);
+        }
+
+        start_load_reports();
+    }
+
+    void state::start_log_sync() {
+        if (config_->publish_log_path_.empty() || config_->publish_log_fsync_interval_ == 0 ||
+            string_to_fsync_policy(config_->publish_log_fsync_) != fsync_interval)
+            return;
+
+        log_timer_.expires_after(std::chrono::milliseconds(config_->publish_log_fsync_interval_));
+        log_timer_.async_wait([_state = weak_from_this()](const boost::system::error_code &ec) {
+            if (const auto _instance = _state.lock())
+                _instance->on_log_timer(ec);
+        });
+    }
+
+    void state::sync_publish_logs() const {
+        std::shared_lock _lock(publish_logs_mutex_);
+        for (const auto &_log: publish_logs_ | std::views::values)
+            _log->sync();
+    }
+
+    void state::on_log_timer(const boost::system::error_code &ec) {
+        if (ec)
+            return;
+
+        // Todo lo agregado desde el último intervalo se confirma en un único msync por segmento.
+        sync_publish_logs();
+
+        start_log_sync();
+    }
+
+    std::shared_ptr<session> state::get_redirect() const {
+        const auto _threshold = config_->load_threshold_;
+        if (_threshold == 0 || is_draining())
+            return nullptr;
+
+        const auto _load = get_load();
+        if (_load.clients_ <= _threshold)
+            return nullptr;
+
+        const auto _peers = get_peers_by_load();
+        if (_peers.empty())
+            return nullptr;
+
+        // Solo se redirige hacia una instancia con reporte conocido, por debajo del umbral y de la carga propia.
+        const auto _peer_load = _peers.front()->get_load();
+        if (!_peer_load.has_value() || _peer_load->clients_ >= _threshold || _peer_load->clients_ >= _load.clients_)
+            return nullptr;
+
+        return _peers.front();
+    }
+
+    std::vector<std::shared_ptr<session> > state::get_peers_by_load() const {
+        std::vector<std::pair<load, std::shared_ptr<session> > > _peers;
+
+        for (const auto &_session: get_sessions()) {
+            if (!_session->get_registered() || !_session->is_healthy() || _session->get_clients_port() == 0)
+                continue;
+
+            // Sin reporte la instancia queda al final, una instancia en drenaje no recibe clientes.
+            const auto _load = _session->get_load().value_or(load{.clients_ = std::numeric_limits<std::size_t>::max()});
+            if (_load.draining_)
+                continue;
+
+            _peers.emplace_back(_load, _session);
+        }
+
+        std::ranges::stable_sort(_peers, [](const auto &_a, const auto &_b) {
+            return std::tie(_a.first.clients_, _a.first.queued_) < std::tie(_b.first.clients_, _b.first.queued_);
+        });
+
+        std::vector<std::shared_ptr<session> > _sessions;
+        _sessions.reserve(_peers.size());
+        for (auto &_peer: _peers | std::views::values)
+            _sessions.push_back(std::move(_peer));
+
+        return _sessions;
+    }
+
+    bool state::is_draining() const {
+        return draining_.load(std::memory_order_acquire);
+    }
+
+    std::size_t state::drain(const std::chrono::milliseconds window) {
+        if (draining_.exchange(true, std::memory_order_acq_rel))
+            return 0;
+
+        std::vector<std::shared_ptr<client> > _clients; {
+            std::shared_lock _lock(clients_mutex_);
+
+            const auto &_index = clients_.get<clients_by_session>();
+            for (auto [_it, _end] = _index.equal_range(id_); _it != _end; ++_it)
+                _clients.push_back(*_it);
+        }
+
+        const auto _peers = get_peers_by_load();
+
+        // Los clientes se reparten entre las instancias restantes y sus reconexiones se escalonan dentro de la
+        // ventana para no concentrarlas en el mismo instante.
+        for (std::size_t _i = 0; _i < _clients.size(); ++_i) {
+            const auto _now = std::chrono::system_clock::now().time_since_epoch().count();
+            const auto _delay = window.count() * static_cast<std::int64_t>(_i) / static_cast<std::int64_t>(_clients.size());
+
+            boost::json::object _hint_data = {{"delay", _delay}};
+            if (!_peers.empty())
+                _hint_data["redirect"] = make_redirect_object(_peers[_i % _peers.size()]);
+
+            const boost::json::object _hint = {
+                {"transaction_id", to_string(boost::uuids::random_generator()())},
+                {"action", "drain"},
+                {"status", "success"},
+                {"message", "draining"},
+                {"timestamp", _now},
+                {"data", _hint_data},
+            };
+
+            _clients[_i]->drain(std::make_shared<std::string const>(serialize(_hint)));
+        }
+
+        LOG_INFO("state_id=[{}] action=[drain] clients=[{}] peers=[{}]", to_string(id_), _clients.size(),
+                 _peers.size());
+
+        return _clients.size();
+    }
+
+    std::shared_ptr<config> state::get_config() {
+        return config_;
+    }
+
+    boost::asio::ssl::context & state::get_session_listener_ssl_context() {
+        return session_listener_ssl_context_;
+    }
+
+    boost::asio::ssl::context & state::get_session_ssl_context() {
+        return session_ssl_context_;
+    }
+
+    boost::asio::ssl::context & state::get_client_listener_ssl_context() {
+        return client_listener_ssl_context_;
+    }
+
+    boost::asio::ssl::context & state::get_client_ssl_context() {
         return client_ssl_context_;
     }
 
+    bool state::is_advertised(const boost::uuids::uuid owner, const boost::uuids::uuid target) const {
+        return is_relay() ? owner != target : owner == id_;
+    }
+
+    void state::drop_buckets(const boost::uuids::uuid session_id, const std::vector<std::size_t> &buckets) {
+        std::array<bool, digest::buckets> _dropped{};
+        for (const auto _bucket: buckets)
+            _dropped[_bucket] = true;
+
+        std::vector<boost::uuids::uuid> _clients; {
+            std::unique_lock _lock(clients_mutex_);
+
+            auto &_index = clients_.get<clients_by_session>();
+            auto [_it, _end] = _index.equal_range(session_id);
+
+            while (_it != _end) {
+                if (_dropped[digest::get_bucket((*_it)->get_id())]) {
+                    _clients.push_back((*_it)->get_id());
+                    _it = _index.erase(_it);
+                } else {
+                    ++_it;
+                }
+            }
+        } {
+            std::unique_lock _lock(routes_mutex_);
+
+            for (const auto &_client_id: _clients)
+                routes_.erase(_client_id);
+        } {
+            std::unique_lock _lock(subscriptions_mutex_);
+
+            auto &_index = subscriptions_.get<subscriptions_by_session>();
+            auto [_it, _end] = _index.equal_range(session_id);
+
+            while (_it != _end) {
+                if (_dropped[digest::get_bucket(_it->client_id_)])
+                    _it = _index.erase(_it);
+                else
+                    ++_it;
+            }
+        }
+
+        version_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    std::shared_ptr<std::string const> state::make_session_message(const boost::json::object &data) const {
+        if (!is_relay())
+            return std::make_shared<std::string const>(serialize(data));
+
+        // En topología de árbol el origen y los saltos acompañan al mensaje para evitar ciclos.
+        boost::json::object _data = data;
+        _data["origin_id"] = to_string(id_);
+        _data["hops"] = 0;
+
+        return std::make_shared<std::string const>(serialize(_data));
+    }
+
+    std::shared_ptr<std::string const> state::make_relay_message(const request &request) const {
+        const auto &_data = request.data_;
+
+        std::int64_t _hops = 0;
+        if (_data.contains("hops") && _data.at("hops").is_int64())
+            _hops = _data.at("hops").as_int64();
+
+        if (_hops + 1 > config_->relay_max_hops_ || is_loop(_data))
+            return nullptr;
+
+        boost::json::object _relay = _data;
+        if (!_relay.contains("origin_id"))
+            _relay["origin_id"] = to_string(request.entity_id_);
+        _relay["hops"] = _hops + 1;
+
+        return std::make_shared<std::string const>(serialize(_relay));
+    }
+
+    void state::add_route(const std::shared_ptr<client> &client) {
+        // Los clientes locales no tienen sesión que los posea.
+        if (client->get_session_id() == id_)
+            return;
+
+        const auto _session = get_session(client->get_session_id());
+        if (!_session.has_value())
+            return;
+
+        std::unique_lock _lock(routes_mutex_);
+        routes_.insert_or_assign(client->get_id(), _session.value());
+    }
+
     std::size_t state::send_to_sessions(const boost::json::object &data) const {
         auto _sessions = get_sessions();
 
-        auto const _message = std::make_shared<std::string const>(serialize(data));
+        auto const _message = make_session_message(data);
 
         for (const auto &_session: _sessions) {
             _session->send(_message);
@@ -476,15 +1584,32 @@ namespace engine {
         return _sessions.size();
     }
 
+    std::size_t state::send_to_sessions(const boost::json::object &data, const std::string_view key) const {
+        auto _sessions = get_sessions();
+
+        auto const _message = make_session_message(data);
+
+        for (const auto &_session: _sessions) {
+            _session->send(_message, key);
+        }
+
+        return _sessions.size();
+    }
+
     std::size_t state::send_to_others_clients(const std::shared_ptr<boost::json::object> &data,
                                               const boost::uuids::uuid session_id,
                                               const boost::uuids::uuid client_id) const {
+        // Construimos el mensaje compartido
+        return send_to_others_clients(std::make_shared<std::string const>(serialize(*data)), session_id, client_id);
+    }
+
+    std::size_t state::send_to_others_clients(const std::shared_ptr<std::string const> &data,
+                                              const boost::uuids::uuid session_id,
+                                              const boost::uuids::uuid client_id,
+                                              const std::shared_ptr<std::string const> &channel) const {
         // Obtenemos todos los clientes
         auto _clients = get_clients();
 
-        // Construimos el mensaje compartido
-        const auto _data = std::make_shared<std::string const>(serialize(*data));
-
         std::size_t _count = 0;
 
         // Por cada cliente en clientes
@@ -494,11 +1619,82 @@ namespace engine {
                 continue;
 
             // Se envía la transmisión
-            _client->send(_data);
+            if (channel)
+                _client->publish(data, channel);
+            else
+                _client->send(data);
             _count++;
         }
 
         // Se retorna la cantidad de clientes con excepción.
         return _count;
     }
+
+    channel_history *state::get_history(const std::string &channel, const bool create) {
+        if (config_->history_messages_ == 0 || config_->history_bytes_ == 0)
+            return nullptr;
+
+        {
+            std::shared_lock _lock(histories_mutex_);
+            if (const auto _it = histories_.find(channel); _it != histories_.end())
+                return _it->second.get();
+        }
+
+        if (!create)
+            return nullptr;
+
+        std::unique_lock _lock(histories_mutex_);
+        auto &_history = histories_[channel];
+        if (!_history) {
+            const auto _age = std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::milliseconds(config_->history_age_)).count();
+            _history = std::make_unique<channel_history>(config_->history_messages_, config_->history_bytes_, _age);
+
+            // La numeración continúa desde lo que quedó en disco.
+            if (const auto _log = get_log(channel, true); _log != nullptr)
+                _history->resume(_log->get_next_sequence());
+        }
+
+        return _history.get();
+    }
+
+    publish_log *state::get_log(const std::string &channel, const bool create) {
+        if (config_->publish_log_path_.empty())
+            return nullptr;
+
+        {
+            std::shared_lock _lock(publish_logs_mutex_);
+            if (const auto _it = publish_logs_.find(channel); _it != publish_logs_.end())
+                return _it->second.get();
+        }
+
+        // El canal se codifica en hexadecimal para que cualquier nombre sea un directorio válido, los que no
+        // entran en un nombre de archivo quedan sin log.
+        if (channel.size() * 2 > NAME_MAX) {
+            if (create)
+                LOG_INFO("state_id=[{}] action=[publish_log] channel_bytes=[{}] status=[name_too_long]",
+                         to_string(id_), channel.size());
+            return nullptr;
+        }
+
+        std::string _name;
+        _name.reserve(channel.size() * 2);
+        for (const auto _character: channel)
+            fmt::format_to(std::back_inserter(_name), "{:02x}", static_cast<unsigned char>(_character));
+
+        const auto _directory = std::filesystem::path(config_->publish_log_path_) / _name;
+
+        // Sin crear sólo se abre un log que ya quedó en disco, por ejemplo antes de reiniciar.
+        if (std::error_code _ec; !create && !std::filesystem::is_directory(_directory, _ec))
+            return nullptr;
+
+        std::unique_lock _lock(publish_logs_mutex_);
+        auto &_log = publish_logs_[channel];
+        if (!_log)
+            _log = std::make_unique<publish_log>(_directory, config_->publish_log_segment_bytes_,
+                                                 config_->publish_log_segments_,
+                                                 string_to_fsync_policy(config_->publish_log_fsync_));
+
+        return _log.get();
+    }
 } // namespace engine
@@ -0,0 +1,328 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/tls_stream.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/kdf.h>
+#include <openssl/ssl.h>
+
+#if defined(__linux__) && __has_include(<linux/tls.h>)
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#define ENGINE_KTLS_AVAILABLE
+#endif
+
+#ifdef ENGINE_KTLS_AVAILABLE
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif
+
+namespace engine {
+    namespace {
+        /**
+         * Traffic Secrets
+         */
+        struct traffic_secrets {
+            /**
+             * Client
+             */
+            std::vector<unsigned char> client_;
+
+            /**
+             * Server
+             */
+            std::vector<unsigned char> server_;
+        };
+
+        /**
+         * Wipe
+         *
+         * @param secret
+         */
+        void wipe(std::vector<unsigned char> &secret) {
+            if (!secret.empty())
+                OPENSSL_cleanse(secret.data(), secret.size());
+            secret.clear();
+        }
+
+        /**
+         * Free Traffic Secrets
+         */
+        void free_traffic_secrets(void *, void *pointer, CRYPTO_EX_DATA *, int, long, void *) {
+            auto *_secrets = static_cast<traffic_secrets *>(pointer);
+            if (_secrets == nullptr)
+                return;
+
+            wipe(_secrets->client_);
+            wipe(_secrets->server_);
+            delete _secrets;
+        }
+
+        /**
+         * Get Secrets Index
+         *
+         * @return int
+         */
+        int get_secrets_index() {
+            static const int _index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, free_traffic_secrets);
+            return _index;
+        }
+
+        /**
+         * From Hex
+         *
+         * @param hex
+         * @return vector<unsigned char>
+         */
+        std::vector<unsigned char> from_hex(const std::string_view hex) {
+            auto _nibble = [](const char c) -> int {
+                if (c >= '0' && c <= '9') return c - '0';
+                if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+                if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+                return -1;
+            };
+
+            std::vector<unsigned char> _result;
+            _result.reserve(hex.size() / 2);
+
+            for (std::size_t _i = 0; _i + 1 < hex.size(); _i += 2) {
+                const int _high = _nibble(hex[_i]);
+                const int _low = _nibble(hex[_i + 1]);
+                if (_high < 0 || _low < 0)
+                    return {};
+                _result.push_back(static_cast<unsigned char>(_high << 4 | _low));
+            }
+
+            return _result;
+        }
+
+        /**
+         * On Keylog
+         *
+         * OpenSSL hands out the application traffic secrets only through the keylog callback.
+         *
+         * @param ssl
+         * @param line
+         */
+        void on_keylog(const SSL *ssl, const char *line) {
+            const std::string_view _line(line);
+
+            std::vector<unsigned char> traffic_secrets::*_member = nullptr;
+            if (_line.starts_with("CLIENT_TRAFFIC_SECRET_0 "))
+                _member = &traffic_secrets::client_;
+            else if (_line.starts_with("SERVER_TRAFFIC_SECRET_0 "))
+                _member = &traffic_secrets::server_;
+            else
+                return;
+
+            auto *_ssl = const_cast<SSL *>(ssl);
+            auto *_secrets = static_cast<traffic_secrets *>(SSL_get_ex_data(_ssl, get_secrets_index()));
+
+            if (_secrets == nullptr) {
+                _secrets = new traffic_secrets();
+                if (SSL_set_ex_data(_ssl, get_secrets_index(), _secrets) != 1) {
+                    delete _secrets;
+                    return;
+                }
+            }
+
+            (*_secrets).*_member = from_hex(_line.substr(_line.rfind(' ') + 1));
+        }
+
+#ifdef ENGINE_KTLS_AVAILABLE
+        /**
+         * Expand Label
+         *
+         * HKDF-Expand-Label from RFC 8446 section 7.1 with an empty context.
+         *
+         * @param md
+         * @param secret
+         * @param label
+         * @param out
+         * @param length
+         * @return bool
+         */
+        bool expand_label(const EVP_MD *md, const std::vector<unsigned char> &secret, const std::string_view label,
+                          unsigned char *out, std::size_t length) {
+            const std::string _label = std::string("tls13 ").append(label);
+
+            std::vector<unsigned char> _info;
+            _info.reserve(4 + _label.size());
+            _info.push_back(static_cast<unsigned char>(length >> 8));
+            _info.push_back(static_cast<unsigned char>(length & 0xff));
+            _info.push_back(static_cast<unsigned char>(_label.size()));
+            _info.insert(_info.end(), _label.begin(), _label.end());
+            _info.push_back(0);
+
+            EVP_PKEY_CTX *_context = EVP_PKEY_CTX_new_id(EVP_PKEY_HKDF, nullptr);
+            if (_context == nullptr)
+                return false;
+
+            const bool _derived =
+                    EVP_PKEY_derive_init(_context) > 0 &&
+                    EVP_PKEY_CTX_set_hkdf_mode(_context, EVP_PKEY_HKDEF_MODE_EXPAND_ONLY) > 0 &&
+                    EVP_PKEY_CTX_set_hkdf_md(_context, md) > 0 &&
+                    EVP_PKEY_CTX_set1_hkdf_key(_context, secret.data(), static_cast<int>(secret.size())) > 0 &&
+                    EVP_PKEY_CTX_add1_hkdf_info(_context, _info.data(), static_cast<int>(_info.size())) > 0 &&
+                    EVP_PKEY_derive(_context, out, &length) > 0;
+
+            EVP_PKEY_CTX_free(_context);
+            return _derived;
+        }
+
+        /**
+         * Install TX
+         *
+         * @param descriptor
+         * @param md
+         * @param secret
+         * @param info
+         * @return bool
+         */
+        template<class CryptoInfo>
+        bool install_tx(const int descriptor, const EVP_MD *md, const std::vector<unsigned char> &secret,
+                        CryptoInfo &info) {
+            unsigned char _iv[sizeof(info.salt) + sizeof(info.iv)];
+
+            bool _installed = expand_label(md, secret, "key", info.key, sizeof(info.key)) &&
+                              expand_label(md, secret, "iv", _iv, sizeof(_iv));
+
+            if (_installed) {
+                // Ningún registro de aplicación fue escrito todavía, la secuencia inicia en cero.
+                std::memcpy(info.salt, _iv, sizeof(info.salt));
+                std::memcpy(info.iv, _iv + sizeof(info.salt), sizeof(info.iv));
+                std::memset(info.rec_seq, 0, sizeof(info.rec_seq));
+
+                _installed = setsockopt(descriptor, IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls")) == 0 &&
+                             setsockopt(descriptor, SOL_TLS, TLS_TX, &info, sizeof(info)) == 0;
+            }
+
+            OPENSSL_cleanse(_iv, sizeof(_iv));
+            OPENSSL_cleanse(&info, sizeof(info));
+            return _installed;
+        }
+
+        /**
+         * On Kernel TX Message
+         *
+         * Once the kernel owns the write sequence anything OpenSSL writes by itself (alerts, a KeyUpdate answer)
+         * would be encrypted twice, the connection is closed instead.
+         *
+         * @param write_p
+         * @param version
+         * @param content_type
+         * @param buf
+         * @param len
+         * @param ssl
+         * @param arg
+         */
+        void on_kernel_tx_message(const int write_p, const int version, const int content_type, const void *buf,
+                                  const std::size_t len, SSL *ssl, void *arg) {
+            boost::ignore_unused(version, ssl);
+
+            const auto *_bytes = static_cast<const unsigned char *>(buf);
+
+            // Un KeyUpdate con update_requested obliga a rotar la llave de envío, el kernel no la conoce.
+            const bool _update_requested = write_p == 0 && content_type == SSL3_RT_HANDSHAKE && len >= 5 &&
+                                           _bytes[0] == SSL3_MT_KEY_UPDATE && _bytes[4] == SSL_KEY_UPDATE_REQUESTED;
+
+            if (write_p == 1 || _update_requested)
+                ::shutdown(static_cast<int>(reinterpret_cast<std::intptr_t>(arg)), SHUT_RDWR);
+        }
+#endif
+    }
+
+    bool tls_stream::enable_kernel_tx(const boost::asio::ssl::stream_base::handshake_type type) {
+        SSL *_ssl = stream_.native_handle();
+        auto *_secrets = static_cast<traffic_secrets *>(SSL_get_ex_data(_ssl, get_secrets_index()));
+
+        if (_secrets == nullptr)
+            return false;
+
+        bool _installed = false;
+
+#ifdef ENGINE_KTLS_AVAILABLE
+        const auto &_secret = type == boost::asio::ssl::stream_base::server ? _secrets->server_ : _secrets->client_;
+        const SSL_CIPHER *_cipher = SSL_get_current_cipher(_ssl);
+
+        if (SSL_version(_ssl) == TLS1_3_VERSION && _cipher != nullptr && !_secret.empty()) {
+            const EVP_MD *_md = SSL_CIPHER_get_handshake_digest(_cipher);
+            const int _descriptor = stream_.lowest_layer().native_handle();
+
+            switch (SSL_CIPHER_get_id(_cipher)) {
+                case TLS1_3_CK_AES_128_GCM_SHA256: {
+                    tls12_crypto_info_aes_gcm_128 _info{};
+                    _info.info.version = TLS_1_3_VERSION;
+                    _info.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+                    _installed = install_tx(_descriptor, _md, _secret, _info);
+                    break;
+                }
+                case TLS1_3_CK_AES_256_GCM_SHA384: {
+                    tls12_crypto_info_aes_gcm_256 _info{};
+                    _info.info.version = TLS_1_3_VERSION;
+                    _info.info.cipher_type = TLS_CIPHER_AES_GCM_256;
+                    _installed = install_tx(_descriptor, _md, _secret, _info);
+                    break;
+                }
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+                case TLS1_3_CK_CHACHA20_POLY1305_SHA256: {
+                    tls12_crypto_info_chacha20_poly1305 _info{};
+                    _info.info.version = TLS_1_3_VERSION;
+                    _info.info.cipher_type = TLS_CIPHER_CHACHA20_POLY1305;
+                    _installed = install_tx(_descriptor, _md, _secret, _info);
+                    break;
+                }
+#endif
+                default:
+                    break;
+            }
+        }
+#else
+        boost::ignore_unused(type);
+#endif
+
+#ifdef ENGINE_KTLS_AVAILABLE
+        if (_installed) {
+            SSL_set_msg_callback_arg(_ssl, reinterpret_cast<void *>(static_cast<std::intptr_t>(
+                                         stream_.lowest_layer().native_handle())));
+            SSL_set_msg_callback(_ssl, on_kernel_tx_message);
+        }
+#endif
+
+        wipe(_secrets->client_);
+        wipe(_secrets->server_);
+
+        kernel_tx_ = _installed;
+        return _installed;
+    }
+
+    void tls_stream::prepare_context(boost::asio::ssl::context &context, const bool listener) {
+        SSL_CTX *_context = context.native_handle();
+
+#ifdef SSL_OP_ENABLE_KTLS
+        SSL_CTX_set_options(_context, SSL_OP_ENABLE_KTLS);
+#endif
+
+        SSL_CTX_set_keylog_callback(_context, on_keylog);
+
+        // Los tickets de sesión se escriben por OpenSSL después del handshake y desfasarían la secuencia del kernel.
+        if (listener)
+            SSL_CTX_set_num_tickets(_context, 0);
+    }
+} // namespace engine
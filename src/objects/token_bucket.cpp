@@ -0,0 +1,47 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/token_bucket.hpp>
+
+#include <algorithm>
+
+namespace engine {
+    token_bucket::token_bucket(const std::size_t rate, const std::size_t burst) {
+        if (rate == 0)
+            return;
+
+        interval_ = std::max<std::int64_t>(1'000'000'000 / static_cast<std::int64_t>(rate), 1);
+        tolerance_ = interval_ * static_cast<std::int64_t>(std::max<std::size_t>(burst, 1) - 1);
+    }
+
+    bool token_bucket::is_enabled() const {
+        return interval_ != 0;
+    }
+
+    bool token_bucket::consume(const std::int64_t now) {
+        if (interval_ == 0)
+            return true;
+
+        const auto _tat = std::max(tat_, now);
+        if (_tat - now > tolerance_)
+            return false;
+
+        tat_ = _tat + interval_;
+        return true;
+    }
+
+    bool token_bucket::consume(std::atomic<std::int64_t> &tat, const std::int64_t now) const {
+        if (interval_ == 0)
+            return true;
+
+        auto _current = tat.load(std::memory_order_relaxed);
+        for (;;) {
+            const auto _tat = std::max(_current, now);
+            if (_tat - now > tolerance_)
+                return false;
+
+            if (tat.compare_exchange_weak(_current, _tat + interval_, std::memory_order_relaxed))
+                return true;
+        }
+    }
+} // namespace engine
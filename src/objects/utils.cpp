@@ -37,6 +37,30 @@ namespace engine {
         return params.at(field).as_bool();
     }
 
+    std::vector<std::string> get_param_as_strings(const boost::json::object &params, const char *field) {
+        const auto &_values = params.at(field).as_array();
+
+        std::vector<std::string> _result;
+        _result.reserve(_values.size());
+
+        for (const auto &_value: _values)
+            _result.emplace_back(_value.as_string());
+
+        return _result;
+    }
+
+    std::vector<subscription> make_subscriptions(const boost::uuids::uuid &session_id,
+                                                 const boost::uuids::uuid &client_id,
+                                                 const std::vector<std::string> &channels) {
+        std::vector<subscription> _result;
+        _result.reserve(channels.size());
+
+        for (const auto &_channel: channels)
+            _result.push_back(subscription{session_id, client_id, _channel});
+
+        return _result;
+    }
+
     const boost::json::object &get_params(const request &request) {
         return request.data_.at("params").as_object();
     }
@@ -135,6 +159,53 @@ namespace engine {
         };
     }
 
+    boost::json::object make_subscribe_request_object(const request &request, const boost::uuids::uuid &client_id,
+                                                      const std::vector<std::string> &channels) {
+        return {
+            {"transaction_id", to_string(request.transaction_id_)},
+            {"action", "subscribe"},
+            {
+                "params", {
+                    {"client_id", to_string(client_id)},
+                    {"channels", boost::json::array(channels.begin(), channels.end())},
+                }
+            }
+        };
+    }
+
+    boost::json::object make_unsubscribe_request_object(const request &request, const boost::uuids::uuid &client_id,
+                                                        const std::vector<std::string> &channels) {
+        return {
+            {"transaction_id", to_string(request.transaction_id_)},
+            {"action", "unsubscribe"},
+            {
+                "params", {
+                    {"client_id", to_string(client_id)},
+                    {"channels", boost::json::array(channels.begin(), channels.end())},
+                }
+            }
+        };
+    }
+
+    boost::json::object make_batch_request_object(const request &request, const boost::json::array &requests) {
+        return {
+            {"transaction_id", to_string(request.transaction_id_)},
+            {"action", "batch"},
+            {
+                "params", {
+                    {"requests", requests},
+                }
+            }
+        };
+    }
+
+    boost::json::object make_redirect_object(const std::shared_ptr<session> &session) {
+        return {
+            {"host", session->get_host()},
+            {"clients_port", session->get_clients_port()},
+        };
+    }
+
     const char *get_status(const bool gate, const char *on_true, const char *on_false) {
         return gate
                    ? on_true
@@ -144,4 +215,14 @@ namespace engine {
     std::string kernel_context_to_string(const kernel_context context) {
         return context == on_session ? "on_session" : "on_client";
     }
+
+    fsync_policy string_to_fsync_policy(const std::string_view value) {
+        if (value == "never")
+            return fsync_never;
+
+        if (value == "always")
+            return fsync_always;
+
+        return fsync_interval;
+    }
 } // namespace engine
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/validators/batch_validator.hpp>
+
+#include <engine/request.hpp>
+
+#include <engine/utils.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+namespace engine::validators {
+    bool batch_validator(const request &request) {
+        const boost::json::value &_params = get_params_as_value(request);
+        const boost::json::object &_params_object = _params.as_object();
+        if (!_params_object.contains("requests")) {
+            mark_as_invalid(request, "params", "params requests attribute must be present");
+            return false;
+        }
+
+        const boost::json::value &_requests = _params_object.at("requests");
+        if (!_requests.is_array() || _requests.as_array().empty()) {
+            mark_as_invalid(request, "params", "params requests attribute must be non empty array");
+            return false;
+        }
+
+        if (const auto _max = request.state_->get_config()->batch_max_requests_;
+            _requests.as_array().size() > _max) {
+            mark_as_invalid(request, "params",
+                            fmt::format("params requests attribute must have at most {} elements", _max).data());
+            return false;
+        }
+
+        for (const auto &_item: _requests.as_array()) {
+            if (!_item.is_object()) {
+                mark_as_invalid(request, "params", "params requests elements must be object");
+                return false;
+            }
+
+            // Los elementos se ejecutan en línea sobre el hilo de la conexión, sólo se aceptan acciones que nunca se
+            // suspenden, un session anidado bloquearía el hilo mientras reintenta conectar.
+            constexpr std::array<std::string_view, 4> _allowed{"subscribe", "unsubscribe", "is_subscribed", "ping"};
+            if (const auto *_action = _item.as_object().if_contains("action");
+                _action != nullptr && _action->is_string() &&
+                std::ranges::find(_allowed, std::string_view(_action->as_string())) == _allowed.end()) {
+                mark_as_invalid(request, "params",
+                                "params requests elements action must be subscribe, unsubscribe, is_subscribed or ping");
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,28 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/validators/confirm_validator.hpp>
+
+#include <engine/request.hpp>
+#include <engine/validator.hpp>
+
+#include <engine/utils.hpp>
+
+namespace engine::validators {
+    bool confirm_validator(const request &request) {
+        const boost::json::value &_params = get_params_as_value(request);
+        const boost::json::object &_params_object = _params.as_object();
+        if (!_params_object.contains("sequence")) {
+            mark_as_invalid(request, "params", "params sequence attribute must be present");
+            return false;
+        }
+
+        if (const boost::json::value &_sequence = _params_object.at("sequence");
+            !_sequence.is_int64() || _sequence.as_int64() < 0) {
+            mark_as_invalid(request, "params", "params sequence attribute must be positive integer");
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,39 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/validators/digest_validator.hpp>
+
+#include <engine/digest.hpp>
+#include <engine/request.hpp>
+#include <engine/validator.hpp>
+
+#include <engine/utils.hpp>
+
+namespace engine::validators {
+    bool digest_validator(const request &request) {
+        const boost::json::value &_params = get_params_as_value(request);
+        const boost::json::object &_params_object = _params.as_object();
+        if (!_params_object.contains("buckets")) {
+            mark_as_invalid(request, "params", "params buckets attribute must be present");
+            return false;
+        }
+
+        if (const boost::json::value &_buckets = _params_object.at("buckets"); !_buckets.is_array() ||
+                                                                            !digest::from_array(_buckets.as_array())) {
+            mark_as_invalid(request, "params", "params buckets attribute must be array of 64 integers");
+            return false;
+        }
+
+        if (!_params_object.contains("version")) {
+            mark_as_invalid(request, "params", "params version attribute must be present");
+            return false;
+        }
+
+        if (const boost::json::value &_version = _params_object.at("version"); !_version.is_int64()) {
+            mark_as_invalid(request, "params", "params version attribute must be integer");
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/validators/load_validator.hpp>
+
+#include <engine/request.hpp>
+#include <engine/validator.hpp>
+
+#include <engine/utils.hpp>
+#include <fmt/format.h>
+
+namespace engine::validators {
+    bool load_validator(const request &request) {
+        const boost::json::value &_params = get_params_as_value(request);
+        const boost::json::object &_params_object = _params.as_object();
+
+        for (const auto _attribute: {"clients", "rate", "queued"}) {
+            if (!_params_object.contains(_attribute)) {
+                mark_as_invalid(request, "params", fmt::format("params {} attribute must be present", _attribute).data());
+                return false;
+            }
+
+            if (const boost::json::value &_value = _params_object.at(_attribute); !_value.is_number()) {
+                mark_as_invalid(request, "params", fmt::format("params {} attribute must be number", _attribute).data());
+                return false;
+            }
+        }
+
+        // Los contadores se leen como enteros, un decimal o un negativo no puede llegar al handler.
+        for (const auto _attribute: {"clients", "queued"}) {
+            if (const boost::json::value &_value = _params_object.at(_attribute);
+                !_value.is_int64() || _value.as_int64() < 0) {
+                mark_as_invalid(request, "params",
+                                fmt::format("params {} attribute must be positive integer", _attribute).data());
+                return false;
+            }
+        }
+
+        if (_params_object.contains("draining") && !_params_object.at("draining").is_bool()) {
+            mark_as_invalid(request, "params", "params draining attribute must be boolean");
+            return false;
+        }
+
+        return true;
+    }
+}
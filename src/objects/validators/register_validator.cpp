@@ -45,6 +45,20 @@ namespace engine::validators {
             return false;
         }
 
+        if (_params_object.contains("state_id") && !id_validator(request, _params_object, "state_id"))
+            return false;
+
+        if (_params_object.contains("lane")) {
+            if (const boost::json::value &_lane = _params_object.at("lane"); !_lane.is_number()) {
+                mark_as_invalid(request, "params", "params lane attribute must be number");
+                return false;
+            }
+
+            // Un carril necesita la instancia de origen para encontrar su sesión principal
+            if (!id_validator(request, _params_object, "state_id"))
+                return false;
+        }
+
         return true;
     }
 }
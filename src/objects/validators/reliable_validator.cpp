@@ -0,0 +1,49 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/validators/reliable_validator.hpp>
+#include <engine/validators/id_validator.hpp>
+
+#include <engine/request.hpp>
+#include <engine/validator.hpp>
+
+#include <engine/utils.hpp>
+
+namespace engine::validators {
+    bool reliable_validator(const request &request) {
+        const boost::json::value &_params = get_params_as_value(request);
+        const boost::json::object &_params_object = _params.as_object();
+
+        // Sin client_id se activa el modo confiable, con client_id se retoma el de una conexión anterior.
+        if (_params_object.contains("client_id")) {
+            if (!id_validator(request, _params_object, "client_id"))
+                return false;
+
+            // El client_id es público, sólo el token entregado al activar el modo permite retomar.
+            const auto *_token = _params_object.if_contains("token");
+            if (_token == nullptr) {
+                mark_as_invalid(request, "params", "params token attribute must be present");
+                return false;
+            }
+
+            if (!_token->is_string()) {
+                mark_as_invalid(request, "params", "params token attribute must be string");
+                return false;
+            }
+        }
+
+        if (const auto *_sequence = _params_object.if_contains("sequence"); _sequence != nullptr) {
+            if (!_params_object.contains("client_id")) {
+                mark_as_invalid(request, "params", "params client_id attribute must be present");
+                return false;
+            }
+
+            if (!_sequence->is_int64() || _sequence->as_int64() < 0) {
+                mark_as_invalid(request, "params", "params sequence attribute must be positive integer");
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,40 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/validators/resync_validator.hpp>
+
+#include <engine/digest.hpp>
+#include <engine/request.hpp>
+#include <engine/validator.hpp>
+
+#include <engine/utils.hpp>
+
+#include <algorithm>
+
+namespace engine::validators {
+    bool resync_validator(const request &request) {
+        const boost::json::value &_params = get_params_as_value(request);
+        const boost::json::object &_params_object = _params.as_object();
+        if (!_params_object.contains("buckets")) {
+            mark_as_invalid(request, "params", "params buckets attribute must be present");
+            return false;
+        }
+
+        if (const boost::json::value &_buckets = _params_object.at("buckets"); !_buckets.is_array()) {
+            mark_as_invalid(request, "params", "params buckets attribute must be array");
+            return false;
+        }
+
+        const auto _is_bucket = [](const boost::json::value &_bucket) {
+            return _bucket.is_int64() && _bucket.as_int64() >= 0 &&
+                   _bucket.as_int64() < static_cast<std::int64_t>(digest::buckets);
+        };
+
+        if (!std::ranges::all_of(_params_object.at("buckets").as_array(), _is_bucket)) {
+            mark_as_invalid(request, "params", "params buckets attribute must contain bucket numbers");
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -9,17 +9,60 @@
 
 #include <engine/utils.hpp>
 
+#include <fmt/format.h>
+
 namespace engine::validators {
     bool subscriptions_validator(const request &request) {
         const boost::json::value &_params = get_params_as_value(request);
         const boost::json::object &_params_object = _params.as_object();
-        if (!_params_object.contains("channel")) {
+        const bool _has_channels = _params_object.contains("channels");
+        if (!_params_object.contains("channel") && !_has_channels) {
             mark_as_invalid(request, "params", "params channel attribute must be present");
             return false;
         }
 
-        if (const boost::json::value &_channel = _params_object.at("channel"); !_channel.is_string()) {
-            mark_as_invalid(request, "params", "params channel attribute must be string");
+        if (_params_object.contains("channel") && _has_channels) {
+            mark_as_invalid(request, "params", "params channel and channels attributes can't be used together");
+            return false;
+        }
+
+        if (!_has_channels) {
+            if (const boost::json::value &_channel = _params_object.at("channel"); !_channel.is_string()) {
+                mark_as_invalid(request, "params", "params channel attribute must be string");
+                return false;
+            }
+        } else {
+            const boost::json::value &_channels = _params_object.at("channels");
+            if (!_channels.is_array() || _channels.as_array().empty()) {
+                mark_as_invalid(request, "params", "params channels attribute must be non empty array");
+                return false;
+            }
+
+            for (const auto &_channel: _channels.as_array()) {
+                if (!_channel.is_string()) {
+                    mark_as_invalid(request, "params", "params channels elements must be string");
+                    return false;
+                }
+            }
+
+            // Las secuencias son propias de cada canal.
+            if (_params_object.contains("since")) {
+                mark_as_invalid(request, "params", "params since attribute can't be used with channels");
+                return false;
+            }
+        }
+
+        for (const auto _attribute: {"since", "since_timestamp"}) {
+            if (const auto *_value = _params_object.if_contains(_attribute);
+                _value != nullptr && (!_value->is_int64() || _value->as_int64() < 0)) {
+                mark_as_invalid(request, "params",
+                                fmt::format("params {} attribute must be positive integer", _attribute).data());
+                return false;
+            }
+        }
+
+        if (const auto *_conflate = _params_object.if_contains("conflate"); _conflate != nullptr && !_conflate->is_bool()) {
+            mark_as_invalid(request, "params", "params conflate attribute must be boolean");
             return false;
         }
 
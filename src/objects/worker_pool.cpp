@@ -0,0 +1,73 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <engine/worker_pool.hpp>
+
+#include <boost/asio/post.hpp>
+
+namespace engine {
+    namespace {
+        /**
+         * Release Guard
+         *
+         * Gives back the slot of a task when it leaves its scope.
+         */
+        struct release_guard {
+            /**
+             * Pending
+             */
+            std::atomic<std::size_t> &pending_;
+
+            /**
+             * Destructor
+             */
+            ~release_guard() {
+                pending_.fetch_sub(1, std::memory_order_acq_rel);
+            }
+        };
+    }
+
+    bool worker_pool::submit(std::function<void()> task, const std::size_t capacity) {
+        auto _pending = pending_.load(std::memory_order_relaxed);
+        do {
+            if (_pending >= capacity) {
+                rejected_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        } while (!pending_.compare_exchange_weak(_pending, _pending + 1, std::memory_order_acq_rel));
+
+        post(ioc_, [this, _task = std::move(task), _queued_at = std::chrono::steady_clock::now()] {
+            const auto _started_at = std::chrono::steady_clock::now();
+            queue_time_.record(_started_at - _queued_at);
+
+            // El cupo se libera aunque la tarea lance, de lo contrario la cola se agota de a poco.
+            const release_guard _guard{pending_};
+
+            _task();
+
+            run_time_.record(std::chrono::steady_clock::now() - _started_at);
+        });
+
+        return true;
+    }
+
+    boost::asio::io_context &worker_pool::get_ioc() {
+        return ioc_;
+    }
+
+    std::size_t worker_pool::get_pending() const {
+        return pending_.load(std::memory_order_acquire);
+    }
+
+    std::uint64_t worker_pool::get_rejected() const {
+        return rejected_.load(std::memory_order_relaxed);
+    }
+
+    queue_latency worker_pool::get_queue_time() const {
+        return queue_time_.get();
+    }
+
+    queue_latency worker_pool::get_run_time() const {
+        return run_time_.get();
+    }
+} // namespace engine
@@ -0,0 +1,90 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "server_base.hpp"
+#include <engine/logger.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/json/parse.hpp>
+
+#include <string>
+#include <vector>
+
+class batch_test : public server_test {
+protected:
+    void prepare(const std::shared_ptr<engine::config> &config) override {
+        config->session_batch_messages_ = 16;
+        config->session_batch_delay_ = 200000;
+    }
+
+    /**
+     * Broadcast Many
+     *
+     * Sends the messages back to back from B inside a single batch delay and expects C to receive all of them in
+     * order.
+     *
+     * @param messages
+     */
+    void broadcast_many(const std::vector<std::string> &messages) {
+        boost::asio::io_context _ioc;
+        const auto _client_b = connect(_ioc, server_b_);
+        const auto _client_c = connect(_ioc, server_c_);
+
+        for (const auto &_message : messages) {
+            _client_b->write(boost::asio::buffer(std::string(serialize(boost::json::object{
+                {"transaction_id", to_string(boost::uuids::random_generator()())},
+                {"action", "broadcast"},
+                {"params", {{"payload", {{"message", _message}}}}},
+            }))));
+        }
+
+        for (const auto &_message : messages) {
+            boost::beast::flat_buffer _buffer;
+            _client_c->read(_buffer);
+            LOG_INFO("client C should receive batched broadcast MESSAGE ... {}", boost::beast::buffers_to_string(_buffer.data()));
+
+            auto _broadcast_object = boost::json::parse(boost::beast::buffers_to_string(_buffer.data()));
+
+            ASSERT_TRUE(_broadcast_object.is_object());
+            ASSERT_EQ(_broadcast_object.as_object().at("action").as_string(), "broadcast");
+            ASSERT_EQ(_broadcast_object.as_object().at("params").as_object().at("payload").as_object().at("message").as_string(), _message);
+        }
+
+        disconnect(*_client_b);
+        disconnect(*_client_c);
+    }
+};
+
+class batch_bytes_test : public batch_test {
+protected:
+    void prepare(const std::shared_ptr<engine::config> &config) override {
+        batch_test::prepare(config);
+        config->session_batch_bytes_ = 1024;
+    }
+};
+
+TEST_F(batch_test, servers_are_registered) {
+    ASSERT_EQ(server_a_->get_state()->get_sessions().size(), 2);
+    ASSERT_EQ(server_b_->get_state()->get_sessions().size(), 2);
+    ASSERT_EQ(server_c_->get_state()->get_sessions().size(), 2);
+}
+
+TEST_F(batch_test, broadcast_is_delivered_in_batches) {
+    std::vector<std::string> _messages;
+    for (std::size_t _i = 0; _i < 8; ++_i)
+        _messages.push_back(fmt::format("EHLO {}", _i));
+
+    broadcast_many(_messages);
+}
+
+TEST_F(batch_bytes_test, broadcast_is_split_when_crossing_batch_bytes) {
+    // Cada envelope ronda la mitad del límite, el lote se cierra por bytes antes de llenarse de mensajes.
+    std::vector<std::string> _messages;
+    for (std::size_t _i = 0; _i < 8; ++_i)
+        _messages.push_back(fmt::format("{}:{}", _i, std::string(300, 'x')));
+
+    broadcast_many(_messages);
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/channel_history.hpp>
+
+TEST(channel_history_test, evicts_oldest_by_count) {
+    engine::channel_history _history{2, 1024, 0};
+
+    ASSERT_TRUE(_history.append(1, "first"));
+    ASSERT_TRUE(_history.append(2, "second"));
+    ASSERT_TRUE(_history.append(3, "third"));
+
+    const auto _messages = _history.get_since_sequence(0, 3);
+    ASSERT_EQ(_messages.size(), 2);
+    ASSERT_EQ(*_messages[0], "second");
+    ASSERT_EQ(*_messages[1], "third");
+    ASSERT_EQ(_history.get_next_sequence(), 4);
+}
+
+TEST(channel_history_test, evicts_oldest_by_bytes_and_wraps) {
+    engine::channel_history _history{16, 10, 0};
+
+    ASSERT_TRUE(_history.append(1, "aaaa"));
+    ASSERT_TRUE(_history.append(2, "bbbb"));
+    ASSERT_TRUE(_history.append(3, "cccc"));
+    ASSERT_EQ(_history.get_size(), 2);
+    ASSERT_EQ(_history.get_bytes(), 8);
+
+    ASSERT_TRUE(_history.append(4, "dddddd"));
+    ASSERT_EQ(_history.get_bytes(), 10);
+
+    const auto _messages = _history.get_since_sequence(0, 4);
+    ASSERT_EQ(_messages.size(), 2);
+    ASSERT_EQ(*_messages[0], "cccc");
+    ASSERT_EQ(*_messages[1], "dddddd");
+
+    ASSERT_FALSE(_history.append(5, "larger than the ring"));
+    ASSERT_EQ(_history.get_next_sequence(), 6);
+}
+
+TEST(channel_history_test, replays_since_sequence_and_timestamp) {
+    engine::channel_history _history{16, 1024, 0};
+
+    ASSERT_TRUE(_history.append(10, "first"));
+    ASSERT_TRUE(_history.append(20, "second"));
+    ASSERT_TRUE(_history.append(30, "third"));
+
+    const auto _by_sequence = _history.get_since_sequence(2, 30);
+    ASSERT_EQ(_by_sequence.size(), 1);
+    ASSERT_EQ(*_by_sequence[0], "third");
+
+    const auto _by_timestamp = _history.get_since_timestamp(20, 30);
+    ASSERT_EQ(_by_timestamp.size(), 2);
+    ASSERT_EQ(*_by_timestamp[0], "second");
+
+    ASSERT_TRUE(_history.get_since_sequence(3, 30).empty());
+}
+
+TEST(channel_history_test, skips_expired_envelopes) {
+    engine::channel_history _history{16, 1024, 100};
+
+    ASSERT_TRUE(_history.append(0, "first"));
+    ASSERT_TRUE(_history.append(50, "second"));
+
+    ASSERT_EQ(_history.get_since_sequence(0, 120).size(), 1);
+
+    ASSERT_TRUE(_history.append(200, "third"));
+    ASSERT_EQ(_history.get_size(), 1);
+}
+
+TEST(channel_history_test, resumes_numbering_only_when_empty) {
+    engine::channel_history _history{16, 1024, 0};
+
+    _history.resume(42);
+    ASSERT_EQ(_history.get_next_sequence(), 42);
+
+    ASSERT_TRUE(_history.append(1, "first"));
+    _history.resume(100);
+    ASSERT_EQ(_history.get_next_sequence(), 43);
+}
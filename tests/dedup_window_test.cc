@@ -0,0 +1,48 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/dedup_window.hpp>
+
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+TEST(dedup_window_test, parses_uuid_keys) {
+    const auto _key = engine::dedup_window::make_key("00112233-4455-6677-8899-aabbccddeeff");
+
+    ASSERT_TRUE(_key.has_value());
+    ASSERT_EQ(_key->high_, 0x0011223344556677ULL);
+    ASSERT_EQ(_key->low_, 0x8899aabbccddeeffULL);
+
+    ASSERT_FALSE(engine::dedup_window::make_key("not an uuid").has_value());
+    ASSERT_FALSE(engine::dedup_window::make_key("00112233-4455-6677-8899-aabbccddeefg").has_value());
+}
+
+TEST(dedup_window_test, drops_duplicates_inside_ttl) {
+    engine::dedup_window _window{1024, std::chrono::seconds(10)};
+    const auto _now = std::chrono::steady_clock::now();
+    const auto _key = engine::dedup_window::make_key(to_string(boost::uuids::random_generator()())).value();
+
+    ASSERT_TRUE(_window.insert(_key, _now));
+    ASSERT_FALSE(_window.insert(_key, _now + std::chrono::seconds(4)));
+    ASSERT_FALSE(_window.insert(_key, _now + std::chrono::seconds(9)));
+    ASSERT_TRUE(_window.insert(_key, _now + std::chrono::seconds(21)));
+
+    ASSERT_EQ(_window.get_hits(), 2);
+    ASSERT_EQ(_window.get_misses(), 2);
+}
+
+TEST(dedup_window_test, keeps_memory_bounded) {
+    engine::dedup_window _window{256, std::chrono::seconds(10)};
+    const auto _slots = _window.get_slots();
+    const auto _now = std::chrono::steady_clock::now();
+
+    for (int _i = 0; _i < 100000; ++_i) {
+        const auto _key = engine::dedup_window::make_key(to_string(boost::uuids::random_generator()())).value();
+        ASSERT_TRUE(_window.insert(_key, _now));
+    }
+
+    ASSERT_EQ(_window.get_slots(), _slots);
+    ASSERT_EQ(_window.get_misses(), 100000);
+}
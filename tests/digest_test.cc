@@ -0,0 +1,54 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/digest.hpp>
+
+#include <boost/uuid/random_generator.hpp>
+
+TEST(digest_test, is_independent_of_insertion_order) {
+    const auto _first = boost::uuids::random_generator()();
+    const auto _second = boost::uuids::random_generator()();
+
+    engine::digest _a;
+    _a.add_client(_first);
+    _a.add_client(_second);
+    _a.add_subscription(_first, "general");
+
+    engine::digest _b;
+    _b.add_subscription(_first, "general");
+    _b.add_client(_second);
+    _b.add_client(_first);
+
+    ASSERT_TRUE(_a.compare(_b).empty());
+}
+
+TEST(digest_test, reports_mismatched_buckets) {
+    const auto _client_id = boost::uuids::random_generator()();
+
+    engine::digest _a;
+    _a.add_client(_client_id);
+    _a.add_subscription(_client_id, "general");
+
+    engine::digest _b;
+    _b.add_client(_client_id);
+
+    const auto _buckets = _a.compare(_b);
+    ASSERT_EQ(_buckets.size(), 1);
+    ASSERT_EQ(_buckets.front(), engine::digest::get_bucket(_client_id));
+}
+
+TEST(digest_test, can_be_serialized) {
+    engine::digest _digest;
+    _digest.add_client(boost::uuids::random_generator()());
+
+    const auto _array = _digest.to_array();
+    ASSERT_EQ(_array.size(), engine::digest::buckets);
+
+    const auto _restored = engine::digest::from_array(_array);
+    ASSERT_TRUE(_restored.has_value());
+    ASSERT_TRUE(_restored->compare(_digest).empty());
+
+    ASSERT_FALSE(engine::digest::from_array(boost::json::array{1, 2, 3}).has_value());
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/server.hpp>
+#include <engine/state.hpp>
+#include <engine/logger.hpp>
+
+#include <boost/asio/strand.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/json/parse.hpp>
+
+TEST(drain_test, hints_clients_and_stops) {
+    const auto _server = std::make_shared<engine::server>();
+    const auto &_config = _server->get_config();
+    _config->sessions_port_.store(0, std::memory_order_release);
+    _config->clients_port_.store(0, std::memory_order_release);
+    _config->repl_enabled = false;
+    _config->threads_ = 1;
+    _config->drain_deadline_ = 2000;
+
+    std::jthread _thread([&_server]() {
+        _server->start();
+    });
+
+    while (_config->clients_port_.load(std::memory_order_acquire) == 0 || _config->sessions_port_.load(
+               std::memory_order_acquire) == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    boost::asio::io_context _ioc;
+    boost::asio::ip::tcp::resolver _resolver{make_strand(_ioc)};
+    boost::beast::websocket::stream<boost::asio::ssl::stream<boost::asio::ip::tcp::socket> > _client{
+        make_strand(_ioc), _server->get_state()->get_client_ssl_context()
+    };
+
+    auto const _results = _resolver.resolve("localhost", std::to_string(
+                                                _config->clients_port_.load(std::memory_order_acquire)));
+    boost::asio::connect(boost::beast::get_lowest_layer(_client), _results);
+
+    _client.next_layer().handshake(boost::asio::ssl::stream_base::client);
+    _client.handshake(fmt::format("localhost:{}", _config->clients_port_.load(std::memory_order_acquire)), "/");
+
+    {
+        boost::beast::flat_buffer _buffer;
+        _client.read(_buffer);
+        LOG_INFO("receiving client welcome ...");
+    }
+
+    _server->drain();
+    ASSERT_TRUE(_server->get_state()->is_draining());
+
+    {
+        boost::beast::flat_buffer _buffer;
+        _client.read(_buffer);
+
+        auto _hint = boost::json::parse(boost::beast::buffers_to_string(_buffer.data()));
+
+        ASSERT_TRUE(_hint.is_object());
+        ASSERT_EQ(_hint.as_object().at("action").as_string(), "drain");
+        ASSERT_TRUE(_hint.as_object().at("data").as_object().contains("delay"));
+    }
+
+    {
+        boost::beast::flat_buffer _buffer;
+        boost::system::error_code _ec;
+        _client.read(_buffer, _ec);
+
+        ASSERT_EQ(_ec, boost::beast::websocket::error::closed);
+        ASSERT_EQ(_client.reason().code, boost::beast::websocket::close_code::going_away);
+    }
+
+    _thread.join();
+
+    ASSERT_TRUE(_server->get_state()->get_clients().empty());
+}
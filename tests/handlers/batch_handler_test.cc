@@ -0,0 +1,216 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/kernel.hpp>
+#include <engine/kernel_context.hpp>
+
+#include <engine/response.hpp>
+#include <engine/session.hpp>
+#include <engine/client.hpp>
+#include <engine/state.hpp>
+#include <engine/logger.hpp>
+
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include "../helpers.hpp"
+
+using namespace engine;
+
+TEST(handlers_batch_handler_test, can_handle_batch_on_client) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+    _state->subscribe(_state->get_id(), _client->get_id(), "news");
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "batch"},
+        {"transaction_id", to_string(_transaction_id)},
+        {
+            "params",
+            {
+                {
+                    "requests",
+                    boost::json::array{
+                        {
+                            {"action", "subscribe"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", {{"channel", "welcome"}}}
+                        },
+                        {
+                            {"action", "subscribe"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", {{"channel", "news"}}}
+                        },
+                        {
+                            {"action", "ping"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                        },
+                        {
+                            {"action", "unsubscribe"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", {{"channel", "news"}}}
+                        },
+                    }
+                }
+            }
+        }
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    const auto &_responses = _response->get_data().at("data").as_object().at("responses").as_array();
+    ASSERT_EQ(_responses.size(), 4);
+    ASSERT_EQ(_responses[0].as_object().at("message").as_string(), "ok");
+    ASSERT_EQ(_responses[1].as_object().at("message").as_string(), "no effect");
+    ASSERT_EQ(_responses[3].as_object().at("message").as_string(), "ok");
+
+    ASSERT_TRUE(_state->is_subscribed(_client->get_id(), "welcome"));
+    ASSERT_FALSE(_state->is_subscribed(_client->get_id(), "news"));
+
+    _state->remove_client(_client->get_id());
+}
+
+TEST(handlers_batch_handler_test, can_handle_nested_batch_failure) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "batch"},
+        {"transaction_id", to_string(_transaction_id)},
+        {
+            "params",
+            {
+                {
+                    "requests",
+                    boost::json::array{
+                        {
+                            {"action", "batch"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", {{"requests", boost::json::array{}}}}
+                        },
+                    }
+                }
+            }
+        }
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(_response->get_failed());
+
+    _state->remove_client(_client->get_id());
+}
+
+TEST(handlers_batch_handler_test, can_handle_suspending_action_failure) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _session_id = boost::uuids::random_generator()();
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "batch"},
+        {"transaction_id", to_string(_transaction_id)},
+        {
+            "params",
+            {
+                {
+                    "requests",
+                    boost::json::array{
+                        {
+                            {"action", "session"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", {{"host", "localhost"}, {"sessions_port", 1}, {"clients_port", 1}}}
+                        },
+                    }
+                }
+            }
+        }
+    };
+
+    // Un session dentro del lote correría en un contexto propio bloqueando el hilo, se rechaza antes.
+    const auto _response = kernel(_state, _data, on_session, _session_id);
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(_response->get_failed());
+}
+
+TEST(handlers_batch_handler_test, can_offload_batch_to_workers) {
+    const auto _state = std::make_shared<state>();
+    _state->get_config()->worker_threads_ = 1;
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "batch"},
+        {"transaction_id", to_string(_transaction_id)},
+        {
+            "params",
+            {
+                {
+                    "requests",
+                    boost::json::array{
+                        {
+                            {"action", "subscribe"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", {{"channel", "welcome"}}}
+                        },
+                    }
+                }
+            }
+        }
+    };
+
+    boost::asio::io_context _io_context;
+    std::shared_ptr<response> _completed;
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id(), nullptr, _io_context.get_executor(),
+                                  [&_completed](const std::shared_ptr<response> &response) {
+                                      _completed = response;
+                                  });
+
+    ASSERT_TRUE(_response->is_offloaded());
+    ASSERT_TRUE(_response->is_deferred());
+    ASSERT_EQ(_state->get_workers().get_pending(), 1);
+
+    _state->get_workers().get_ioc().run();
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_EQ(_completed, nullptr);
+
+    _io_context.run();
+
+    ASSERT_EQ(_completed, _response);
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+    ASSERT_TRUE(_state->is_subscribed(_client->get_id(), "welcome"));
+    ASSERT_EQ(_state->get_workers().get_run_time().count_, 1);
+
+    _state->remove_client(_client->get_id());
+}
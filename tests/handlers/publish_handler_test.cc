@@ -16,6 +16,8 @@
 #include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
+#include <filesystem>
+
 #include "../helpers.hpp"
 
 using namespace engine;
@@ -100,3 +102,34 @@ TEST(handlers_publish_handler_test, can_handle_publish_on_session) {
     _state->remove_client(_client->get_id());
     _state->remove_client(_other->get_id());
 }
+
+TEST(handlers_publish_handler_test, can_log_publish_without_history) {
+    const auto _config = std::make_shared<config>();
+    _config->history_messages_ = 0;
+    _config->publish_log_path_ = (std::filesystem::temp_directory_path() / "publish_handler_test_log").string();
+    std::filesystem::remove_all(_config->publish_log_path_);
+
+    const auto _state = std::make_shared<state>(_config);
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+    const auto _other = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+    _state->push_client(_other);
+
+    const boost::json::object _data = {
+        {"action", "publish"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"params", {{"channel", "welcome"}, {"payload", {{"message", "EHLO"}}}}}
+    };
+
+    ASSERT_FALSE(kernel(_state, _data, on_client, _client->get_id())->get_failed());
+
+    // El log no depende del historial en memoria, la repetición lo lee desde disco.
+    ASSERT_TRUE(std::filesystem::exists(_config->publish_log_path_));
+    ASSERT_EQ(_state->replay(_other->get_id(), "welcome", 0, std::nullopt), 1);
+
+    _state->remove_client(_client->get_id());
+    _state->remove_client(_other->get_id());
+    std::filesystem::remove_all(_config->publish_log_path_);
+}
@@ -124,3 +124,51 @@ TEST(handlers_register_handler_test, can_handle_register_no_effect_on_client) {
     ASSERT_TRUE(_response->get_data().contains("data"));
     ASSERT_TRUE(_response->get_data().at("data").is_object());
 }
+
+TEST(handlers_register_handler_test, can_handle_register_lane_on_session) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _primary = std::make_shared<session>(_state, boost::asio::ip::tcp::socket{_state->get_ioc()}, local);
+    const auto _lane = std::make_shared<session>(_state, boost::asio::ip::tcp::socket{_state->get_ioc()}, local);
+
+    const auto _node_id = boost::uuids::random_generator()();
+
+    _primary->set_node_id(_node_id);
+    _primary->mark_as_registered();
+
+    _state->add_session(_primary);
+    _state->add_session(_lane);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "register"},
+        {"transaction_id", to_string(_transaction_id)},
+        {
+            "params",
+            {
+                {"registered", true},
+                {"clients_port", 10000},
+                {"sessions_port", 9000},
+                {"state_id", to_string(_node_id)},
+                {"lane", 1}
+            }
+        }
+    };
+
+    const auto _response = kernel(_state, _data, on_session, _lane->get_id());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    ASSERT_EQ(_lane->get_lane(), 1);
+    ASSERT_EQ(_primary->get_lanes_count(), 1);
+    ASSERT_FALSE(_state->get_session(_lane->get_id()).has_value());
+    ASSERT_EQ(_state->get_sessions().size(), 1);
+
+    _state->remove_session(_primary->get_id());
+}
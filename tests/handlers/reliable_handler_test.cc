@@ -0,0 +1,208 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/kernel.hpp>
+#include <engine/kernel_context.hpp>
+
+#include <engine/response.hpp>
+#include <engine/session.hpp>
+#include <engine/client.hpp>
+#include <engine/state.hpp>
+#include <engine/logger.hpp>
+
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include <thread>
+
+#include "../helpers.hpp"
+
+using namespace engine;
+
+TEST(handlers_reliable_handler_test, can_resume_and_confirm_on_client) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _lost = std::make_shared<client>(_state->get_id(), _state);
+    _state->add_client(_lost);
+
+    const boost::json::object _enable_data = {
+        {"action", "reliable"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"params", boost::json::object{}}
+    };
+
+    const auto _enable = kernel(_state, _enable_data, on_client, _lost->get_id());
+
+    ASSERT_TRUE(_enable->get_processed());
+    ASSERT_FALSE(_enable->get_failed());
+    ASSERT_FALSE(_enable->get_data().at("data").as_object().at("resumed").as_bool());
+
+    const auto _buffer = _state->get_reliable_buffer(_lost->get_id());
+    ASSERT_NE(_buffer, nullptr);
+
+    const auto _token = _enable->get_data().at("data").as_object().at("token").as_string();
+    ASSERT_EQ(_token, _buffer->get_token());
+
+    for (int _i = 0; _i < 3; ++_i)
+        _buffer->push(std::make_shared<std::string const>("{}"));
+
+    // La conexión se pierde y el cliente vuelve desde otra indicando lo último que recibió.
+    _state->remove_client(_lost->get_id());
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+    _state->add_client(_client);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _resume_data = {
+        {"action", "reliable"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"params", {{"client_id", to_string(_lost->get_id())}, {"token", _token}, {"sequence", 1}}}
+    };
+
+    const auto _resume = kernel(_state, _resume_data, on_client, _client->get_id());
+
+    LOG_INFO("response processed={} failed={} data={}", _resume->get_processed(), _resume->get_failed(),
+             serialize(_resume->get_data()));
+
+    test_response_base_protocol_structure(_resume, "success", "ok", _transaction_id);
+
+    const auto &_result = _resume->get_data().at("data").as_object();
+    ASSERT_TRUE(_result.at("resumed").as_bool());
+    ASSERT_EQ(_result.at("redelivered").as_uint64(), 2);
+    ASSERT_EQ(_result.at("first_sequence").as_uint64(), 2);
+    ASSERT_EQ(_result.at("dropped").as_uint64(), 0);
+    ASSERT_EQ(_state->get_reliable_buffer(_client->get_id()), _buffer);
+    ASSERT_EQ(_state->get_reliable_buffer(_lost->get_id()), nullptr);
+
+    const boost::json::object _confirm_data = {
+        {"action", "confirm"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"params", {{"sequence", 3}}}
+    };
+
+    const auto _confirm = kernel(_state, _confirm_data, on_client, _client->get_id());
+
+    ASSERT_FALSE(_confirm->get_failed());
+    ASSERT_EQ(_confirm->get_data().at("data").as_object().at("released").as_uint64(), 2);
+    ASSERT_EQ(_buffer->get_size(), 0);
+
+    _state->remove_client(_client->get_id());
+}
+
+TEST(handlers_reliable_handler_test, cannot_resume_without_the_token) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _lost = std::make_shared<client>(_state->get_id(), _state);
+    _state->add_client(_lost);
+    const auto _buffer = _state->enable_reliable(_lost->get_id());
+    _buffer->push(std::make_shared<std::string const>("{}"));
+    _state->remove_client(_lost->get_id());
+
+    // Cualquiera que haya recibido un mensaje conoce el client_id, sin el token no se lleva las entregas.
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+    _state->add_client(_client);
+
+    const boost::json::object _missing_data = {
+        {"action", "reliable"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"params", {{"client_id", to_string(_lost->get_id())}}}
+    };
+
+    ASSERT_TRUE(kernel(_state, _missing_data, on_client, _client->get_id())->get_failed());
+
+    const boost::json::object _wrong_data = {
+        {"action", "reliable"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"params", {{"client_id", to_string(_lost->get_id())}, {"token", std::string(64, '0')}}}
+    };
+
+    const auto _wrong = kernel(_state, _wrong_data, on_client, _client->get_id());
+
+    ASSERT_FALSE(_wrong->get_failed());
+    ASSERT_FALSE(_wrong->get_data().at("data").as_object().at("resumed").as_bool());
+    ASSERT_EQ(_state->get_reliable_buffer(_lost->get_id()), _buffer);
+
+    _state->remove_client(_client->get_id());
+}
+
+TEST(handlers_reliable_handler_test, cannot_resume_a_connected_client) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _owner = std::make_shared<client>(_state->get_id(), _state);
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+    _state->add_client(_owner);
+    _state->add_client(_client);
+    _state->enable_reliable(_owner->get_id());
+
+    const boost::json::object _response_data = {
+        {"action", "reliable"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"params", {{"client_id", to_string(_owner->get_id())},
+                    {"token", _state->get_reliable_buffer(_owner->get_id())->get_token()}}}
+    };
+
+    const auto _response = kernel(_state, _response_data, on_client, _client->get_id());
+
+    ASSERT_FALSE(_response->get_failed());
+    ASSERT_FALSE(_response->get_data().at("data").as_object().at("resumed").as_bool());
+    ASSERT_NE(_state->get_reliable_buffer(_owner->get_id()), _state->get_reliable_buffer(_client->get_id()));
+
+    _state->remove_client(_owner->get_id());
+    _state->remove_client(_client->get_id());
+}
+
+TEST(handlers_reliable_handler_test, cannot_resume_over_an_own_buffer) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _lost = std::make_shared<client>(_state->get_id(), _state);
+    _state->add_client(_lost);
+    const auto _lost_buffer = _state->enable_reliable(_lost->get_id());
+    _lost_buffer->push(std::make_shared<std::string const>("{}"));
+    _state->remove_client(_lost->get_id());
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+    _state->add_client(_client);
+    const auto _buffer = _state->enable_reliable(_client->get_id());
+    _buffer->push(std::make_shared<std::string const>("{}"));
+
+    // Las entregas sin confirmar de la conexión nueva no se pisan con las de la anterior.
+    const boost::json::object _response_data = {
+        {"action", "reliable"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"params", {{"client_id", to_string(_lost->get_id())}, {"token", _lost_buffer->get_token()}}}
+    };
+
+    const auto _response = kernel(_state, _response_data, on_client, _client->get_id());
+
+    ASSERT_FALSE(_response->get_failed());
+    ASSERT_FALSE(_response->get_data().at("data").as_object().at("resumed").as_bool());
+    ASSERT_EQ(_state->get_reliable_buffer(_client->get_id()), _buffer);
+    ASSERT_EQ(_buffer->get_size(), 1);
+    ASSERT_EQ(_state->get_reliable_buffer(_lost->get_id()), _lost_buffer);
+
+    _state->remove_client(_client->get_id());
+}
+
+TEST(handlers_reliable_handler_test, drops_the_oldest_orphans) {
+    const auto _state = std::make_shared<state>();
+    _state->get_config()->reliable_orphans_ = 1;
+
+    const auto _first = std::make_shared<client>(_state->get_id(), _state);
+    const auto _second = std::make_shared<client>(_state->get_id(), _state);
+    _state->add_client(_first);
+    _state->add_client(_second);
+    _state->enable_reliable(_first->get_id());
+    _state->enable_reliable(_second->get_id());
+
+    _state->remove_client(_first->get_id());
+    ASSERT_NE(_state->get_reliable_buffer(_first->get_id()), nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    // Sólo cabe un huérfano, el más antiguo deja su lugar al recién desconectado.
+    _state->remove_client(_second->get_id());
+    ASSERT_EQ(_state->get_reliable_buffer(_first->get_id()), nullptr);
+    ASSERT_NE(_state->get_reliable_buffer(_second->get_id()), nullptr);
+}
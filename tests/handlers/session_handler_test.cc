@@ -93,3 +93,52 @@ TEST(handlers_session_handler_test, can_handle_session_no_effect_on_client) {
     ASSERT_TRUE(_response->get_data().contains("data"));
     ASSERT_TRUE(_response->get_data().at("data").is_object());
 }
+
+TEST(handlers_session_handler_test, can_defer_session_on_executor) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _session = std::make_shared<session>(_state, boost::asio::ip::tcp::socket{_state->get_ioc()}, remote);
+
+    _session->set_host("127.0.0.1");
+    _session->set_clients_port(10000);
+    _session->set_sessions_port(9000);
+
+    _state->add_session(_session);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "session"},
+        {"transaction_id", to_string(_transaction_id)},
+        {
+            "params",
+            {
+                {"host", "127.0.0.1"},
+                {"clients_port", 10000},
+                {"sessions_port", 9000}
+            }
+        }
+    };
+
+    boost::asio::io_context _io_context;
+    std::shared_ptr<response> _completed;
+
+    const auto _response = kernel(_state, _data, on_session, _session->get_id(), nullptr,
+                                  _io_context.get_executor(),
+                                  [&_completed](const std::shared_ptr<response> &response) {
+                                      _completed = response;
+                                  });
+
+    ASSERT_TRUE(_response->is_deferred());
+    ASSERT_FALSE(_response->get_processed());
+    ASSERT_EQ(_completed, nullptr);
+
+    _io_context.run();
+
+    ASSERT_EQ(_completed, _response);
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "no effect", _transaction_id);
+
+    _state->remove_session(_session->get_id());
+}
@@ -112,4 +112,40 @@ TEST(handlers_subscribe_handler_test, can_handle_subscribe_on_session) {
     ASSERT_TRUE(_response->get_data().at("data").is_object());
 
     _state->remove_session(_client->get_id());
-}
\ No newline at end of file
+}
+
+TEST(handlers_subscribe_handler_test, can_handle_subscribe_channels_on_client) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+    _state->subscribe(_state->get_id(), _client->get_id(), "news");
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "subscribe"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"params", {{"channels", boost::json::array{"welcome", "news", "prices"}}}}
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    const auto &_channels = _response->get_data().at("data").as_object().at("channels").as_object();
+    ASSERT_EQ(_channels.at("welcome").as_string(), "ok");
+    ASSERT_EQ(_channels.at("news").as_string(), "no effect");
+    ASSERT_EQ(_channels.at("prices").as_string(), "ok");
+
+    ASSERT_TRUE(_state->is_subscribed(_client->get_id(), "welcome"));
+    ASSERT_TRUE(_state->is_subscribed(_client->get_id(), "prices"));
+
+    _state->remove_client(_client->get_id());
+}
@@ -0,0 +1,69 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/server.hpp>
+#include <engine/state.hpp>
+#include <engine/logger.hpp>
+
+#include <boost/asio/strand.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/json/parse.hpp>
+
+TEST(handshake_pool_test, accepts_clients_from_handshake_threads) {
+    const auto _server = std::make_shared<engine::server>();
+    const auto &_config = _server->get_config();
+    _config->sessions_port_.store(0, std::memory_order_release);
+    _config->clients_port_.store(0, std::memory_order_release);
+    _config->repl_enabled = false;
+    _config->threads_ = 1;
+    _config->handshake_threads_ = 2;
+
+    std::jthread _thread([&_server]() {
+        _server->start();
+    });
+
+    while (_config->clients_port_.load(std::memory_order_acquire) == 0 || _config->sessions_port_.load(
+               std::memory_order_acquire) == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    boost::asio::io_context _ioc;
+    boost::asio::ip::tcp::resolver _resolver{make_strand(_ioc)};
+    boost::beast::websocket::stream<boost::asio::ssl::stream<boost::asio::ip::tcp::socket> > _client{
+        make_strand(_ioc), _server->get_state()->get_client_ssl_context()
+    };
+
+    auto const _results = _resolver.resolve("localhost", std::to_string(
+                                                _config->clients_port_.load(std::memory_order_acquire)));
+    boost::asio::connect(boost::beast::get_lowest_layer(_client), _results);
+
+    const auto _host = fmt::format("localhost:{}", std::to_string(
+                                       _config->clients_port_.load(std::memory_order_acquire)));
+
+    _client.next_layer().handshake(boost::asio::ssl::stream_base::client);
+    _client.handshake(_host, "/");
+
+    boost::beast::flat_buffer _buffer;
+    _client.read(_buffer);
+
+    auto _welcome = boost::json::parse(boost::beast::buffers_to_string(_buffer.data()));
+
+    ASSERT_TRUE(_welcome.is_object());
+    ASSERT_EQ(_welcome.as_object().at("action").as_string(), "welcome");
+    ASSERT_EQ(_welcome.as_object().at("status").as_string(), "success");
+    ASSERT_EQ(_server->get_state()->get_clients().size(), 1);
+
+    boost::system::error_code _ec;
+    _client.close(boost::beast::websocket::close_code::normal, _ec);
+    _client.next_layer().shutdown(_ec);
+
+    while (!_server->get_state()->get_clients().empty()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    _server->stop();
+}
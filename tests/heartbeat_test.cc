@@ -0,0 +1,36 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "server_base.hpp"
+#include <engine/session.hpp>
+
+class heartbeat_test : public server_test {
+protected:
+    void prepare(const std::shared_ptr<engine::config> &config) override {
+        config->session_heartbeat_interval_ = 50;
+    }
+};
+
+TEST_F(heartbeat_test, sessions_measure_round_trip_time) {
+    const auto _measured = [this] {
+        for (const auto &_server: {server_a_, server_b_, server_c_}) {
+            for (const auto &_session: _server->get_state()->get_sessions()) {
+                if (_session->get_rtt() < 0)
+                    return false;
+            }
+        }
+        return true;
+    };
+
+    for (int _attempt = 0; _attempt < 100 && !_measured(); ++_attempt)
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    ASSERT_TRUE(_measured());
+
+    for (const auto &_session: server_a_->get_state()->get_sessions()) {
+        ASSERT_TRUE(_session->is_healthy());
+        ASSERT_GE(_session->get_jitter(), 0);
+    }
+}
@@ -0,0 +1,30 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/last_value_cache.hpp>
+
+TEST(last_value_cache_test, keeps_the_most_recent_value) {
+    engine::last_value_cache _cache;
+
+    ASSERT_EQ(_cache.load("prices"), nullptr);
+
+    ASSERT_TRUE(_cache.store("prices", std::make_shared<std::string const>("first"), 4));
+    ASSERT_TRUE(_cache.store("prices", std::make_shared<std::string const>("second"), 4));
+
+    ASSERT_EQ(*_cache.load("prices"), "second");
+    ASSERT_EQ(_cache.get_size(), 1);
+}
+
+TEST(last_value_cache_test, is_bounded_by_channels) {
+    engine::last_value_cache _cache;
+
+    ASSERT_TRUE(_cache.store("first", std::make_shared<std::string const>("a"), 1));
+    ASSERT_FALSE(_cache.store("second", std::make_shared<std::string const>("b"), 1));
+    ASSERT_TRUE(_cache.store("first", std::make_shared<std::string const>("c"), 1));
+
+    ASSERT_EQ(_cache.load("second"), nullptr);
+    ASSERT_EQ(*_cache.load("first"), "c");
+    ASSERT_EQ(_cache.get_size(), 1);
+}
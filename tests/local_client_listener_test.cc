@@ -0,0 +1,64 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/server.hpp>
+#include <engine/state.hpp>
+
+#include <filesystem>
+
+#include <fmt/format.h>
+
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+TEST(local_client_listener_test, accepts_plaintext_clients) {
+    const auto _path = (std::filesystem::temp_directory_path() / fmt::format(
+                            "engine-{}.sock", to_string(boost::uuids::random_generator()()))).string();
+
+    const auto _server = std::make_shared<engine::server>();
+    const auto &_config = _server->get_config();
+    _config->sessions_port_.store(0, std::memory_order_release);
+    _config->clients_port_.store(0, std::memory_order_release);
+    _config->clients_socket_path_ = _path;
+    _config->repl_enabled = false;
+    _config->threads_ = 1;
+
+    std::jthread _thread([&_server]() {
+        _server->start();
+    });
+
+    while (_config->clients_port_.load(std::memory_order_acquire) == 0 || !std::filesystem::exists(_path)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    const auto _permissions = std::filesystem::status(_path).permissions();
+    ASSERT_EQ(_permissions & std::filesystem::perms::others_all, std::filesystem::perms::none);
+
+    boost::asio::io_context _ioc;
+    boost::beast::websocket::stream<boost::asio::local::stream_protocol::socket> _client{_ioc};
+    _client.next_layer().connect(boost::asio::local::stream_protocol::endpoint{_path});
+    _client.handshake("localhost", "/");
+
+    boost::beast::flat_buffer _buffer;
+    _client.read(_buffer);
+
+    auto _welcome = boost::json::parse(boost::beast::buffers_to_string(_buffer.data()));
+
+    ASSERT_TRUE(_welcome.is_object());
+    ASSERT_EQ(_welcome.as_object().at("action").as_string(), "welcome");
+    ASSERT_EQ(_server->get_state()->get_clients().size(), 1);
+
+    boost::system::error_code _ec;
+    _client.close(boost::beast::websocket::close_code::normal, _ec);
+
+    while (!_server->get_state()->get_clients().empty()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    _server->stop();
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/outbound_queue.hpp>
+
+namespace {
+    std::string write_next(engine::outbound_queue &queue) {
+        const auto _item = queue.next();
+        std::string _data = *_item->data_;
+        queue.complete();
+        return _data;
+    }
+}
+
+TEST(outbound_queue_test, control_overtakes_bulk) {
+    engine::outbound_queue _queue;
+    const auto _now = std::chrono::steady_clock::now();
+
+    ASSERT_TRUE(_queue.push(std::make_shared<std::string const>("bulk-1"), engine::bulk, _now));
+    ASSERT_TRUE(_queue.push(std::make_shared<std::string const>("bulk-2"), engine::bulk, _now));
+    ASSERT_TRUE(_queue.push(std::make_shared<std::string const>("ack"), engine::control, _now));
+
+    ASSERT_EQ(write_next(_queue), "ack");
+    ASSERT_EQ(write_next(_queue), "bulk-1");
+    ASSERT_EQ(write_next(_queue), "bulk-2");
+    ASSERT_TRUE(_queue.empty());
+    ASSERT_EQ(_queue.next(), nullptr);
+}
+
+TEST(outbound_queue_test, in_flight_message_blocks_writer_start) {
+    engine::outbound_queue _queue;
+    const auto _now = std::chrono::steady_clock::now();
+
+    ASSERT_TRUE(_queue.push(std::make_shared<std::string const>("first"), engine::bulk, _now));
+    ASSERT_NE(_queue.next(), nullptr);
+
+    ASSERT_FALSE(_queue.push(std::make_shared<std::string const>("second"), engine::control, _now));
+    ASSERT_EQ(_queue.size(), 2);
+
+    _queue.complete();
+    ASSERT_EQ(_queue.size(), 1);
+}
+
+TEST(outbound_queue_test, weight_lets_bulk_through) {
+    engine::outbound_queue _queue{2};
+    const auto _now = std::chrono::steady_clock::now();
+
+    _queue.push(std::make_shared<std::string const>("bulk"), engine::bulk, _now);
+    for (const auto _name: {"c1", "c2", "c3"})
+        _queue.push(std::make_shared<std::string const>(_name), engine::control, _now);
+
+    ASSERT_EQ(write_next(_queue), "c1");
+    ASSERT_EQ(write_next(_queue), "c2");
+    ASSERT_EQ(write_next(_queue), "bulk");
+    ASSERT_EQ(write_next(_queue), "c3");
+}
+
+TEST(outbound_queue_test, conflates_undelivered_messages_by_key) {
+    engine::outbound_queue _queue;
+    const auto _now = std::chrono::steady_clock::now();
+
+    ASSERT_FALSE(_queue.replace("prices", std::make_shared<std::string const>("ignored")));
+
+    _queue.push(std::make_shared<std::string const>("prices-1"), engine::bulk, _now, "prices");
+    _queue.push(std::make_shared<std::string const>("news-1"), engine::bulk, _now, "news");
+
+    ASSERT_TRUE(_queue.replace("prices", std::make_shared<std::string const>("prices-2")));
+    ASSERT_EQ(_queue.size(), 2);
+
+    ASSERT_EQ(write_next(_queue), "prices-2");
+
+    // Ya entregado el mensaje deja de ser reemplazable.
+    ASSERT_FALSE(_queue.replace("prices", std::make_shared<std::string const>("prices-3")));
+    _queue.push(std::make_shared<std::string const>("prices-3"), engine::bulk, _now, "prices");
+    ASSERT_TRUE(_queue.replace("prices", std::make_shared<std::string const>("prices-4")));
+
+    ASSERT_EQ(write_next(_queue), "news-1");
+    ASSERT_EQ(write_next(_queue), "prices-4");
+    ASSERT_TRUE(_queue.empty());
+}
@@ -0,0 +1,152 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/publish_log.hpp>
+#include <engine/logger.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+    std::filesystem::path make_directory(const std::string &name) {
+        auto _path = std::filesystem::temp_directory_path() / ("publish_log_test_" + name);
+        std::filesystem::remove_all(_path);
+        return _path;
+    }
+}
+
+TEST(publish_log_test, reads_since_sequence_and_timestamp) {
+    const auto _directory = make_directory("reads");
+    engine::publish_log _log{_directory, 65536, 4, engine::fsync_never};
+
+    ASSERT_EQ(_log.get_next_sequence(), 1);
+    ASSERT_TRUE(_log.append(1, 10, "first"));
+    ASSERT_TRUE(_log.append(2, 20, "second"));
+    ASSERT_TRUE(_log.append(3, 30, "third"));
+    ASSERT_EQ(_log.get_next_sequence(), 4);
+
+    std::vector<std::string> _messages;
+    const auto _collect = [&_messages](const engine::publish_log::record &record) {
+        _messages.emplace_back(record.data_);
+    };
+
+    ASSERT_EQ(_log.read_since_sequence(1, _collect), 2);
+    ASSERT_EQ(_messages, (std::vector<std::string>{"second", "third"}));
+
+    _messages.clear();
+    ASSERT_EQ(_log.read_since_timestamp(30, _collect), 1);
+    ASSERT_EQ(_messages, (std::vector<std::string>{"third"}));
+
+    ASSERT_EQ(_log.read_since_sequence(3, _collect), 0);
+    std::filesystem::remove_all(_directory);
+}
+
+TEST(publish_log_test, stops_reading_at_the_limit) {
+    const auto _directory = make_directory("limit");
+    engine::publish_log _log{_directory, 65536, 4, engine::fsync_never};
+
+    ASSERT_TRUE(_log.append(1, 10, "first"));
+    ASSERT_TRUE(_log.append(2, 20, "second"));
+    ASSERT_TRUE(_log.append(3, 30, "third"));
+
+    std::vector<std::string> _messages;
+    const auto _collect = [&_messages](const engine::publish_log::record &record) {
+        _messages.emplace_back(record.data_);
+    };
+
+    ASSERT_EQ(_log.read_since_sequence(0, _collect, 11), 2);
+    ASSERT_EQ(_messages, (std::vector<std::string>{"first", "second"}));
+
+    // El primer registro se entrega aunque supere el límite, así la lectura siempre avanza.
+    _messages.clear();
+    ASSERT_EQ(_log.read_since_timestamp(0, _collect, 1), 1);
+    ASSERT_EQ(_messages, (std::vector<std::string>{"first"}));
+
+    std::filesystem::remove_all(_directory);
+}
+
+TEST(publish_log_test, recovers_after_reopen_and_discards_torn_tail) {
+    const auto _directory = make_directory("recovers");
+    {
+        engine::publish_log _log{_directory, 65536, 4, engine::fsync_always};
+        ASSERT_TRUE(_log.append(1, 10, "first"));
+        ASSERT_TRUE(_log.append(2, 20, "second"));
+    }
+
+    // Se corrompe el último registro como si la escritura hubiese quedado a medias.
+    const auto _file = std::filesystem::directory_iterator(_directory)->path();
+    {
+        std::fstream _stream{_file, std::ios::in | std::ios::out | std::ios::binary};
+        _stream.seekp(32 + 24);
+        _stream.put('x');
+    }
+
+    engine::publish_log _log{_directory, 65536, 4, engine::fsync_always};
+    ASSERT_EQ(_log.get_next_sequence(), 2);
+
+    ASSERT_TRUE(_log.append(2, 30, "again"));
+
+    std::vector<std::string> _messages;
+    _log.read_since_sequence(0, [&_messages](const engine::publish_log::record &record) {
+        _messages.emplace_back(record.data_);
+    });
+    ASSERT_EQ(_messages, (std::vector<std::string>{"first", "again"}));
+    std::filesystem::remove_all(_directory);
+}
+
+TEST(publish_log_test, removes_oldest_segments_beyond_retention) {
+    const auto _directory = make_directory("retention");
+    engine::publish_log _log{_directory, 4096, 2, engine::fsync_never};
+
+    const std::string _payload(1000, 'p');
+    for (std::uint64_t _sequence = 1; _sequence <= 20; ++_sequence)
+        ASSERT_TRUE(_log.append(_sequence, static_cast<std::int64_t>(_sequence), _payload));
+
+    ASSERT_EQ(_log.get_segments_count(), 2);
+    ASSERT_FALSE(_log.append(21, 21, std::string(4096, 'x')));
+
+    std::uint64_t _first = 0;
+    const auto _count = _log.read_since_sequence(0, [&_first](const engine::publish_log::record &record) {
+        if (_first == 0)
+            _first = record.sequence_;
+    });
+    ASSERT_EQ(_first + _count - 1, 20);
+    ASSERT_GT(_first, 1);
+    std::filesystem::remove_all(_directory);
+}
+
+// Medición de 200k registros, se corre a pedido con --gtest_also_run_disabled_tests.
+TEST(publish_log_test, DISABLED_measures_appends_and_replay) {
+    const auto _directory = make_directory("benchmark");
+    engine::publish_log _log{_directory, 16777216, 8, engine::fsync_interval};
+
+    constexpr std::uint64_t _records = 200000;
+    const std::string _payload(256, 'b');
+
+    const auto _start = std::chrono::steady_clock::now();
+    for (std::uint64_t _sequence = 1; _sequence <= _records; ++_sequence) {
+        ASSERT_TRUE(_log.append(_sequence, static_cast<std::int64_t>(_sequence), _payload));
+        if (_sequence % 4096 == 0)
+            _log.sync();
+    }
+    _log.sync();
+    const auto _appended = std::chrono::steady_clock::now();
+
+    std::size_t _bytes = 0;
+    ASSERT_EQ(_log.read_since_sequence(0, [&_bytes](const engine::publish_log::record &record) {
+        _bytes += record.data_.size();
+    }), _records);
+    const auto _replayed = std::chrono::steady_clock::now();
+
+    const auto _append_seconds = std::chrono::duration<double>(_appended - _start).count();
+    const auto _replay_seconds = std::chrono::duration<double>(_replayed - _appended).count();
+    LOG_INFO("publish_log appends=[{:.0f}/s] replay=[{:.1f}MB/s]", static_cast<double>(_records) / _append_seconds,
+             static_cast<double>(_bytes) / 1048576.0 / _replay_seconds);
+
+    std::filesystem::remove_all(_directory);
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/kernel.hpp>
+#include <engine/kernel_context.hpp>
+#include <engine/rate_limiter.hpp>
+#include <engine/response.hpp>
+#include <engine/state.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include <fmt/format.h>
+
+using namespace engine;
+
+TEST(rate_limiter_test, token_bucket_allows_burst_then_refills) {
+    token_bucket _bucket{10, 3};
+
+    ASSERT_TRUE(_bucket.consume(0));
+    ASSERT_TRUE(_bucket.consume(0));
+    ASSERT_TRUE(_bucket.consume(0));
+    ASSERT_FALSE(_bucket.consume(0));
+
+    ASSERT_TRUE(_bucket.consume(100'000'000));
+    ASSERT_FALSE(_bucket.consume(100'000'000));
+}
+
+TEST(rate_limiter_test, fanout_bucket_only_applies_to_fanout_actions) {
+    config _config;
+    _config.fanout_rate_limit_ = 1;
+    _config.rate_limit_burst_ = 1;
+
+    rate_limiter _limiter{_config};
+
+    ASSERT_TRUE(_limiter.consume("broadcast", 0));
+    ASSERT_FALSE(_limiter.consume("publish", 0));
+    ASSERT_TRUE(_limiter.consume("subscribe", 0));
+}
+
+TEST(rate_limiter_test, kernel_rejects_with_transaction_id) {
+    const auto _state = std::make_shared<state>();
+    _state->get_config()->client_rate_limit_ = 1;
+    _state->get_config()->rate_limit_burst_ = 1;
+
+    rate_limiter _limiter{*_state->get_config()};
+
+    const boost::json::object _data = {
+        {"action", "ping"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+    };
+
+    const auto _client_id = boost::uuids::random_generator()();
+
+    ASSERT_FALSE(kernel(_state, _data, on_client, _client_id, &_limiter)->get_failed());
+
+    const auto _rejected = kernel(_state, _data, on_client, _client_id, &_limiter);
+    ASSERT_TRUE(_rejected->get_failed());
+    ASSERT_TRUE(_rejected->get_processed());
+
+    const auto _message = boost::json::parse(*_rejected->get_message()).as_object();
+    ASSERT_EQ(_message.at("transaction_id"), _data.at("transaction_id"));
+    ASSERT_EQ(_message.at("status").as_string(), "failed");
+    ASSERT_EQ(_message.at("message").as_string(), "too many requests");
+
+    ASSERT_FALSE(kernel(_state, _data, on_session, _client_id, &_limiter)->get_failed());
+}
+
+TEST(rate_limiter_test, channel_limit_is_shared_by_clients) {
+    const auto _state = std::make_shared<state>();
+    _state->get_config()->channel_rate_limit_ = 1;
+    _state->get_config()->rate_limit_burst_ = 1;
+
+    ASSERT_TRUE(_state->allow_publish("prices", 0));
+    ASSERT_FALSE(_state->allow_publish("prices", 0));
+    ASSERT_TRUE(_state->allow_publish("news", 0));
+    ASSERT_TRUE(_state->allow_publish("prices", 1'000'000'000));
+}
+
+TEST(rate_limiter_test, channel_limits_drop_refilled_buckets) {
+    const auto _state = std::make_shared<state>();
+    _state->get_config()->channel_rate_limit_ = 1;
+    _state->get_config()->rate_limit_burst_ = 1;
+
+    for (std::size_t _i = 0; _i < 4096; ++_i)
+        ASSERT_TRUE(_state->allow_publish(fmt::format("channel-{}", _i), 0));
+
+    // Un segundo después todos los baldes se recargaron y el mapa no crece con cada canal nuevo.
+    for (std::size_t _i = 0; _i < 4096; ++_i)
+        ASSERT_TRUE(_state->allow_publish(fmt::format("other-{}", _i), 1'000'000'000));
+
+    ASSERT_LE(_state->get_channel_limits_size(), 4096);
+}
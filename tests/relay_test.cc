@@ -0,0 +1,64 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "server_base.hpp"
+#include <engine/logger.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/json/parse.hpp>
+
+class relay_test : public server_test {
+protected:
+    void prepare(const std::shared_ptr<engine::config> &config) override {
+        config->topology_ = "tree";
+    }
+
+    std::size_t expected_sessions_of_c() const override {
+        return 1;
+    }
+};
+
+TEST_F(relay_test, servers_form_a_tree) {
+    ASSERT_EQ(server_a_->get_state()->get_sessions().size(), 2);
+    ASSERT_EQ(server_b_->get_state()->get_sessions().size(), 1);
+    ASSERT_EQ(server_c_->get_state()->get_sessions().size(), 1);
+}
+
+TEST_F(relay_test, broadcast_is_relayed_through_parent) {
+    boost::asio::io_context _ioc;
+    const auto _client_b = connect(_ioc, server_b_);
+    const auto _client_c = connect(_ioc, server_c_);
+
+    _client_b->write(boost::asio::buffer(std::string(serialize(boost::json::object{
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"action", "broadcast"},
+        {"params", {{"payload", {{"message", "EHLO"}}}}},
+    }))));
+
+    {
+        boost::beast::flat_buffer _buffer;
+        _client_b->read(_buffer);
+        LOG_INFO("client B should receive broadcast ACK ... {}", boost::beast::buffers_to_string(_buffer.data()));
+    }
+
+    {
+        boost::beast::flat_buffer _buffer;
+        _client_c->read(_buffer);
+        LOG_INFO("client C should receive relayed broadcast MESSAGE ... {}", boost::beast::buffers_to_string(_buffer.data()));
+
+        auto _broadcast_object = boost::json::parse(boost::beast::buffers_to_string(_buffer.data()));
+
+        ASSERT_TRUE(_broadcast_object.is_object());
+        ASSERT_EQ(_broadcast_object.as_object().at("action").as_string(), "broadcast");
+        ASSERT_EQ(_broadcast_object.as_object().at("params").as_object().at("payload").as_object().at("message").as_string(), "EHLO");
+    }
+
+    // El origen solo transmite a su padre en lugar de a todas las instancias.
+    ASSERT_EQ(server_b_->get_state()->get_sessions().size(), 1);
+
+    disconnect(*_client_b);
+    disconnect(*_client_c);
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/reliable_buffer.hpp>
+
+#include <memory>
+#include <string>
+
+TEST(reliable_buffer_test, frames_deliveries_and_confirms_cumulatively) {
+    engine::reliable_buffer _buffer{16, 4096};
+
+    const auto _first = _buffer.push(std::make_shared<std::string const>(R"({"action":"publish"})"));
+    ASSERT_EQ(*_first, R"({"action":"deliver","sequence":1,"data":{"action":"publish"}})");
+
+    _buffer.push(std::make_shared<std::string const>("{}"));
+    _buffer.push(std::make_shared<std::string const>("{}"));
+    ASSERT_EQ(_buffer.get_size(), 3);
+    ASSERT_EQ(_buffer.get_next_sequence(), 4);
+
+    ASSERT_EQ(_buffer.confirm(2), 2);
+    ASSERT_EQ(_buffer.confirm(2), 0);
+
+    const auto _unconfirmed = _buffer.get_unconfirmed();
+    ASSERT_EQ(_unconfirmed.size(), 1);
+    ASSERT_EQ(*_unconfirmed[0], R"({"action":"deliver","sequence":3,"data":{}})");
+    ASSERT_EQ(_buffer.get_bytes(), _unconfirmed[0]->size());
+}
+
+TEST(reliable_buffer_test, drops_oldest_beyond_limits) {
+    engine::reliable_buffer _buffer{2, 4096};
+
+    for (int _i = 0; _i < 5; ++_i)
+        _buffer.push(std::make_shared<std::string const>("{}"));
+
+    ASSERT_EQ(_buffer.get_size(), 2);
+    ASSERT_EQ(_buffer.get_dropped(), 3);
+    ASSERT_EQ(_buffer.get_first_sequence(), 4);
+
+    engine::reliable_buffer _small{16, 100};
+    for (int _i = 0; _i < 5; ++_i)
+        _small.push(std::make_shared<std::string const>(std::string(10, 'x')));
+
+    ASSERT_LE(_small.get_bytes(), 100);
+    ASSERT_GT(_small.get_dropped(), 0);
+}
+
+TEST(reliable_buffer_test, expires_only_while_orphan) {
+    engine::reliable_buffer _buffer{16, 4096};
+    const auto _now = std::chrono::steady_clock::now();
+
+    ASSERT_FALSE(_buffer.adopt());
+    ASSERT_FALSE(_buffer.is_expired(_now + std::chrono::hours(1), std::chrono::seconds(60)));
+
+    _buffer.release(_now);
+    ASSERT_FALSE(_buffer.is_expired(_now + std::chrono::seconds(30), std::chrono::seconds(60)));
+    ASSERT_TRUE(_buffer.is_expired(_now + std::chrono::seconds(90), std::chrono::seconds(60)));
+
+    ASSERT_TRUE(_buffer.adopt());
+    ASSERT_FALSE(_buffer.is_expired(_now + std::chrono::seconds(90), std::chrono::seconds(60)));
+}
+
+TEST(reliable_buffer_test, issues_a_secret_token) {
+    const engine::reliable_buffer _buffer{16, 4096};
+    const engine::reliable_buffer _other{16, 4096};
+
+    ASSERT_EQ(_buffer.get_token().size(), 64);
+    ASSERT_NE(_buffer.get_token(), _other.get_token());
+    ASSERT_TRUE(_buffer.is_token(_buffer.get_token()));
+    ASSERT_FALSE(_buffer.is_token(_other.get_token()));
+    ASSERT_FALSE(_buffer.is_token(""));
+}
@@ -0,0 +1,106 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "server_base.hpp"
+#include <engine/logger.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/json/parse.hpp>
+
+class replay_test : public server_test {
+protected:
+    void prepare(const std::shared_ptr<engine::config> &config) override {
+        config->history_messages_ = 16;
+        config->last_value_channels_ = 16;
+        config->queue_control_weight_ = 4;
+    }
+
+    /**
+     * Publish
+     *
+     * @param client
+     * @param message
+     */
+    static void publish(client_stream &client, const std::string &message) {
+        client.write(boost::asio::buffer(std::string(serialize(boost::json::object{
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "publish"},
+            {"params", {{"channel", "general"}, {"payload", {{"message", message}}}}},
+        }))));
+
+        boost::beast::flat_buffer _buffer;
+        client.read(_buffer);
+        LOG_INFO("publisher should receive publish ACK ... {}", boost::beast::buffers_to_string(_buffer.data()));
+    }
+
+    /**
+     * Read Object
+     *
+     * @param client
+     * @return object
+     */
+    static boost::json::object read_object(client_stream &client) {
+        boost::beast::flat_buffer _buffer;
+        client.read(_buffer);
+        LOG_INFO("subscriber receives ... {}", boost::beast::buffers_to_string(_buffer.data()));
+        return boost::json::parse(boost::beast::buffers_to_string(_buffer.data())).as_object();
+    }
+};
+
+TEST_F(replay_test, replay_arrives_before_subscribe_ack) {
+    boost::asio::io_context _ioc;
+    const auto _publisher = connect(_ioc, server_a_);
+    const auto _subscriber = connect(_ioc, server_a_);
+
+    for (const auto _message : { "first", "second", "third" })
+        publish(*_publisher, _message);
+
+    _subscriber->write(boost::asio::buffer(std::string(serialize(boost::json::object{
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"action", "subscribe"},
+        {"params", {{"channel", "general"}, {"since", 0}}},
+    }))));
+
+    // El ack viaja como control, la repetición debe ir en la misma clase para no ser adelantada.
+    for (const auto _message : { "first", "second", "third" }) {
+        const auto _object = read_object(*_subscriber);
+        ASSERT_EQ(_object.at("action").as_string(), "publish");
+        ASSERT_EQ(_object.at("params").as_object().at("payload").as_object().at("message").as_string(), _message);
+    }
+
+    const auto _ack = read_object(*_subscriber);
+    ASSERT_EQ(_ack.at("action").as_string(), "subscribe");
+    ASSERT_EQ(_ack.at("status").as_string(), "success");
+    ASSERT_EQ(_ack.at("data").as_object().at("replayed").as_int64(), 3);
+
+    disconnect(*_publisher);
+    disconnect(*_subscriber);
+}
+
+TEST_F(replay_test, last_value_arrives_before_subscribe_ack) {
+    boost::asio::io_context _ioc;
+    const auto _publisher = connect(_ioc, server_a_);
+    const auto _subscriber = connect(_ioc, server_a_);
+
+    publish(*_publisher, "latest");
+
+    _subscriber->write(boost::asio::buffer(std::string(serialize(boost::json::object{
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"action", "subscribe"},
+        {"params", {{"channel", "general"}}},
+    }))));
+
+    const auto _last_value = read_object(*_subscriber);
+    ASSERT_EQ(_last_value.at("action").as_string(), "publish");
+    ASSERT_EQ(_last_value.at("params").as_object().at("payload").as_object().at("message").as_string(), "latest");
+
+    const auto _ack = read_object(*_subscriber);
+    ASSERT_EQ(_ack.at("action").as_string(), "subscribe");
+    ASSERT_EQ(_ack.at("status").as_string(), "success");
+
+    disconnect(*_publisher);
+    disconnect(*_subscriber);
+}
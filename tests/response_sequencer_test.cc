@@ -0,0 +1,44 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/response_sequencer.hpp>
+
+TEST(response_sequencer_test, sends_completed_replies_in_order) {
+    engine::response_sequencer _sequencer;
+
+    const auto _first = _sequencer.reserve();
+    const auto _second = _sequencer.reserve();
+
+    const auto _ready = _sequencer.complete(_first, std::make_shared<std::string const>("first"));
+    ASSERT_EQ(_ready.size(), 1);
+    ASSERT_EQ(*_ready.front(), "first");
+    ASSERT_EQ(_sequencer.get_pending(), 1);
+
+    const auto _last = _sequencer.complete(_second, std::make_shared<std::string const>("second"));
+    ASSERT_EQ(_last.size(), 1);
+    ASSERT_EQ(*_last.front(), "second");
+    ASSERT_EQ(_sequencer.get_pending(), 0);
+}
+
+TEST(response_sequencer_test, holds_replies_behind_a_deferred_one) {
+    engine::response_sequencer _sequencer;
+
+    const auto _deferred = _sequencer.reserve();
+    const auto _ack = _sequencer.reserve();
+    const auto _ping = _sequencer.reserve();
+
+    ASSERT_TRUE(_sequencer.complete(_ack, nullptr).empty());
+    ASSERT_TRUE(_sequencer.complete(_ping, std::make_shared<std::string const>("pong")).empty());
+    ASSERT_EQ(_sequencer.get_pending(), 3);
+
+    // Los mensajes sin respuesta solo liberan su posición.
+    const auto _ready = _sequencer.complete(_deferred, std::make_shared<std::string const>("session"));
+    ASSERT_EQ(_ready.size(), 2);
+    ASSERT_EQ(*_ready[0], "session");
+    ASSERT_EQ(*_ready[1], "pong");
+    ASSERT_EQ(_sequencer.get_pending(), 0);
+
+    ASSERT_TRUE(_sequencer.complete(_deferred, std::make_shared<std::string const>("late")).empty());
+}
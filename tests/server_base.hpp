@@ -7,12 +7,84 @@
 #include <engine/logger.hpp>
 #include <engine/state.hpp>
 
+#include <boost/core/ignore_unused.hpp>
+#include <boost/asio/connect.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+
+#include <fmt/format.h>
+
 class server_test : public testing::Test {
     std::unique_ptr<std::jthread> thread_a_;
     std::unique_ptr<std::jthread> thread_b_;
     std::unique_ptr<std::jthread> thread_c_;
 
 protected:
+    /**
+     * Prepare
+     *
+     * Hook to adjust the configuration of every server before it starts.
+     *
+     * @param config
+     */
+    virtual void prepare(const std::shared_ptr<engine::config> &config) {
+        boost::ignore_unused(config);
+    }
+
+    /**
+     * Expected Sessions Of C
+     *
+     * @return size_t
+     */
+    virtual std::size_t expected_sessions_of_c() const {
+        return 2;
+    }
+
+    /**
+     * Client Stream
+     */
+    using client_stream = boost::beast::websocket::stream<boost::asio::ssl::stream<boost::asio::ip::tcp::socket>>;
+
+    /**
+     * Connect
+     *
+     * Opens a client connection to the server and consumes its welcome.
+     *
+     * @param ioc
+     * @param server
+     * @return unique_ptr<client_stream>
+     */
+    static std::unique_ptr<client_stream> connect(boost::asio::io_context &ioc,
+                                                  const std::shared_ptr<engine::server> &server) {
+        const auto _port = server->get_config()->clients_port_.load(std::memory_order_acquire);
+
+        auto _client = std::make_unique<client_stream>(make_strand(ioc), server->get_state()->get_client_ssl_context());
+
+        boost::asio::ip::tcp::resolver _resolver{make_strand(ioc)};
+        boost::asio::connect(boost::beast::get_lowest_layer(*_client), _resolver.resolve("localhost", std::to_string(_port)));
+        _client->next_layer().handshake(boost::asio::ssl::stream_base::client);
+        _client->handshake(fmt::format("localhost:{}", _port), "/");
+
+        boost::beast::flat_buffer _buffer;
+        _client->read(_buffer);
+        LOG_INFO("receiving client welcome ...");
+
+        return _client;
+    }
+
+    /**
+     * Disconnect
+     *
+     * @param client
+     */
+    static void disconnect(client_stream &client) {
+        boost::system::error_code _ec;
+        client.close(boost::beast::websocket::close_code::normal, _ec);
+        client.next_layer().shutdown(_ec);
+    }
+
     std::shared_ptr<engine::server> server_a_ = std::make_shared<engine::server>();
     std::shared_ptr<engine::server> server_b_ = std::make_shared<engine::server>();
     std::shared_ptr<engine::server> server_c_ = std::make_shared<engine::server>();
@@ -23,6 +95,7 @@ protected:
         _server_a_config->clients_port_.store(0, std::memory_order_release);
         _server_a_config->repl_enabled = false;
         _server_a_config->threads_ = 1;
+        prepare(_server_a_config);
 
         thread_a_ = std::make_unique<std::jthread>([this]() {
 
@@ -42,6 +115,7 @@ protected:
         _server_b_config->is_node_ = true;
         _server_b_config->repl_enabled = false;
         _server_b_config->threads_ = 1;
+        prepare(_server_b_config);
         _server_b_config->remote_clients_port_.store(
             server_a_->get_config()->clients_port_.load(std::memory_order_acquire), std::memory_order_release);
         _server_b_config->remote_sessions_port_.store(
@@ -66,6 +140,7 @@ protected:
         _server_c_config->is_node_ = true;
         _server_c_config->threads_ = 1;
         _server_c_config->repl_enabled = false;
+        prepare(_server_c_config);
 
         _server_c_config->remote_clients_port_.store(
             server_a_->get_config()->clients_port_.load(std::memory_order_acquire), std::memory_order_release);
@@ -79,7 +154,7 @@ protected:
             LOG_INFO("server C stopped");
         });
 
-        while (_server_c_config->clients_port_.load(std::memory_order_acquire) == 0 || _server_c_config->sessions_port_.load(std::memory_order_acquire) == 0 || !_server_c_config->registered_.load(std::memory_order_acquire) || server_c_->get_state()->get_sessions().size() != 2) {
+        while (_server_c_config->clients_port_.load(std::memory_order_acquire) == 0 || _server_c_config->sessions_port_.load(std::memory_order_acquire) == 0 || !_server_c_config->registered_.load(std::memory_order_acquire) || server_c_->get_state()->get_sessions().size() != expected_sessions_of_c()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
     }
@@ -0,0 +1,67 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/snapshot.hpp>
+
+#include <boost/uuid/random_generator.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+namespace {
+    std::filesystem::path make_path(const std::string &name) {
+        auto _path = std::filesystem::temp_directory_path() / ("snapshot_test_" + name);
+        std::filesystem::remove(_path);
+        return _path;
+    }
+}
+
+TEST(snapshot_test, writes_and_reads_peers) {
+    const auto _path = make_path("round_trip");
+    const auto _node_id = boost::uuids::random_generator()();
+    const auto _client_id = boost::uuids::random_generator()();
+
+    engine::snapshot _peers;
+    _peers[_node_id] = engine::retained_state{
+        .clients_ = {_client_id},
+        .subscriptions_ = {{_client_id, "general"}, {_client_id, "news"}},
+        .version_ = 12,
+    };
+
+    ASSERT_TRUE(engine::write_snapshot(_path, _peers));
+
+    const auto _loaded = engine::read_snapshot(_path);
+    ASSERT_EQ(_loaded.size(), 1);
+    ASSERT_EQ(_loaded.at(_node_id).version_, 12);
+    ASSERT_EQ(_loaded.at(_node_id).clients_, _peers[_node_id].clients_);
+    ASSERT_EQ(_loaded.at(_node_id).subscriptions_, _peers[_node_id].subscriptions_);
+
+    std::filesystem::remove(_path);
+}
+
+TEST(snapshot_test, ignores_missing_and_corrupted_files) {
+    const auto _path = make_path("corrupted");
+    ASSERT_TRUE(engine::read_snapshot(_path).empty());
+
+    engine::snapshot _peers;
+    _peers[boost::uuids::random_generator()()] = engine::retained_state{
+        .clients_ = {boost::uuids::random_generator()()},
+        .version_ = 3,
+    };
+    ASSERT_TRUE(engine::write_snapshot(_path, _peers));
+
+    {
+        std::fstream _stream{_path, std::ios::in | std::ios::out | std::ios::binary};
+        _stream.seekp(20);
+        _stream.put('x');
+    }
+
+    ASSERT_TRUE(engine::read_snapshot(_path).empty());
+
+    std::filesystem::resize_file(_path, 10);
+    ASSERT_TRUE(engine::read_snapshot(_path).empty());
+
+    std::filesystem::remove(_path);
+}
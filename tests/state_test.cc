@@ -5,8 +5,16 @@
 
 #include <engine/session.hpp>
 #include <engine/state.hpp>
+#include <engine/logger.hpp>
+#include <engine/utils.hpp>
 
 #include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <filesystem>
 
 TEST(state_test, can_be_created) {
     const auto _state = std::make_shared<engine::state>();
@@ -32,3 +40,194 @@ TEST(state_test, can_contains_sessions) {
     ASSERT_EQ(_state->get_sessions().size(), 0);
     ASSERT_EQ(_state->get_session(_session->get_id()), std::nullopt);
 }
+
+TEST(state_test, can_route_clients_to_sessions) {
+    const auto _state = std::make_shared<engine::state>();
+
+    boost::asio::io_context _io_context;
+    const auto _session = std::make_shared<engine::session>(_state, boost::asio::ip::tcp::socket{ _io_context });
+    _state->add_session(_session);
+
+    const auto _remote = std::make_shared<engine::client>(_session->get_id(), _state, boost::uuids::random_generator()());
+    const auto _local = std::make_shared<engine::client>(_state->get_id(), _state);
+
+    ASSERT_TRUE(_state->add_client(_remote));
+    ASSERT_TRUE(_state->add_client(_local));
+
+    ASSERT_EQ(_state->get_route(_remote->get_id()), _session);
+    ASSERT_EQ(_state->get_route(_local->get_id()), nullptr);
+
+    _state->remove_client(_remote->get_id());
+    ASSERT_EQ(_state->get_route(_remote->get_id()), nullptr);
+
+    _state->add_client(_remote);
+    _state->remove_state_of_session(_session->get_id());
+    ASSERT_EQ(_state->get_route(_remote->get_id()), nullptr);
+    ASSERT_FALSE(_state->get_client(_remote->get_id()).has_value());
+
+    _state->remove_session(_session->get_id());
+}
+
+TEST(state_test, can_retain_and_adopt_state_of_sessions) {
+    const auto _state = std::make_shared<engine::state>();
+    const auto _node_id = boost::uuids::random_generator()();
+    const auto _client_id = boost::uuids::random_generator()();
+
+    boost::asio::io_context _io_context;
+    const auto _session = std::make_shared<engine::session>(_state, boost::asio::ip::tcp::socket{ _io_context });
+
+    _state->add_client(std::make_shared<engine::client>(_session->get_id(), _state, _client_id));
+    _state->subscribe(_session->get_id(), _client_id, "general");
+
+    const auto _view = _state->get_view(_session->get_id());
+
+    _state->retain_state_of_session(_session->get_id(), _node_id, 7);
+    ASSERT_FALSE(_state->get_client(_client_id).has_value());
+
+    const auto _reconnected = std::make_shared<engine::session>(_state, boost::asio::ip::tcp::socket{ _io_context });
+    ASSERT_EQ(_state->adopt_state_of_session(_reconnected->get_id(), _node_id), 7);
+    ASSERT_TRUE(_state->get_client(_client_id).has_value());
+    ASSERT_TRUE(_state->get_view(_reconnected->get_id()).compare(_view).empty());
+
+    ASSERT_EQ(_state->adopt_state_of_session(_reconnected->get_id(), _node_id), -1);
+}
+
+TEST(state_test, can_restore_peers_from_snapshot) {
+    const auto _config = std::make_shared<engine::config>();
+    _config->snapshot_path_ = (std::filesystem::temp_directory_path() / "state_test_snapshot").string();
+    std::filesystem::remove(_config->snapshot_path_);
+
+    const auto _node_id = boost::uuids::random_generator()();
+    const auto _client_id = boost::uuids::random_generator()();
+
+    boost::asio::io_context _io_context; {
+        const auto _state = std::make_shared<engine::state>(_config);
+        const auto _session = std::make_shared<engine::session>(_state, boost::asio::ip::tcp::socket{ _io_context });
+
+        _state->add_client(std::make_shared<engine::client>(_session->get_id(), _state, _client_id));
+        _state->subscribe(_session->get_id(), _client_id, "general");
+        _state->retain_state_of_session(_session->get_id(), _node_id, 7);
+
+        ASSERT_TRUE(_state->save_snapshot());
+    }
+
+    // Un nuevo estado adopta al par en cuanto se registra, sin esperar una resincronización completa.
+    const auto _state = std::make_shared<engine::state>(_config);
+    ASSERT_EQ(_state->load_snapshot(), 1);
+
+    const auto _session = std::make_shared<engine::session>(_state, boost::asio::ip::tcp::socket{ _io_context });
+    ASSERT_EQ(_state->adopt_state_of_session(_session->get_id(), _node_id), 7);
+    ASSERT_TRUE(_state->get_client(_client_id).has_value());
+    ASSERT_TRUE(_state->is_subscribed(_client_id, "general"));
+
+    std::filesystem::remove(_config->snapshot_path_);
+}
+
+TEST(state_test, can_redirect_to_least_loaded_session) {
+    const auto _config = std::make_shared<engine::config>();
+    _config->load_threshold_ = 1;
+
+    const auto _state = std::make_shared<engine::state>(_config);
+
+    boost::asio::io_context _io_context;
+    const auto _idle = std::make_shared<engine::session>(_state, boost::asio::ip::tcp::socket{ _io_context });
+    const auto _busy = std::make_shared<engine::session>(_state, boost::asio::ip::tcp::socket{ _io_context });
+
+    for (const auto &_session: {_idle, _busy}) {
+        _session->set_clients_port(12000);
+        _session->mark_as_registered();
+        _state->add_session(_session);
+    }
+
+    _idle->set_load(engine::load{.clients_ = 0});
+    _busy->set_load(engine::load{.clients_ = 5});
+
+    _state->add_client(std::make_shared<engine::client>(_state->get_id(), _state));
+    ASSERT_EQ(_state->get_redirect(), nullptr);
+
+    _state->add_client(std::make_shared<engine::client>(_state->get_id(), _state));
+    ASSERT_EQ(_state->get_load().clients_, 2);
+    ASSERT_EQ(_state->get_redirect(), _idle);
+
+    _state->remove_session(_idle->get_id());
+    _state->remove_session(_busy->get_id());
+}
+
+TEST(state_test, can_subscribe_ten_thousand_channels_per_client) {
+    const auto _state = std::make_shared<engine::state>();
+
+    std::vector<std::string> _channels;
+    _channels.reserve(10000);
+    for (std::size_t _i = 0; _i < 10000; ++_i)
+        _channels.push_back(fmt::format("symbol-{}", 9999 - _i));
+
+    const auto _bulk_client_id = boost::uuids::random_generator()();
+    const auto _single_client_id = boost::uuids::random_generator()();
+
+    const auto _bulk_start = std::chrono::steady_clock::now();
+    const auto _inserted = _state->subscribe(engine::make_subscriptions(_state->get_id(), _bulk_client_id, _channels));
+    const auto _bulk_elapsed = std::chrono::steady_clock::now() - _bulk_start;
+
+    const auto _single_start = std::chrono::steady_clock::now();
+    for (const auto &_channel: _channels)
+        _state->subscribe(_state->get_id(), _single_client_id, _channel);
+    const auto _single_elapsed = std::chrono::steady_clock::now() - _single_start;
+
+    LOG_INFO("subscribe channels=[{}] bulk=[{}us] single=[{}us]", _channels.size(),
+             std::chrono::duration_cast<std::chrono::microseconds>(_bulk_elapsed).count(),
+             std::chrono::duration_cast<std::chrono::microseconds>(_single_elapsed).count());
+
+    ASSERT_EQ(std::ranges::count(_inserted, true), 10000);
+    ASSERT_EQ(_state->get_subscriptions().size(), 20000);
+    ASSERT_TRUE(_state->is_subscribed(_bulk_client_id, "symbol-0"));
+    ASSERT_TRUE(_state->is_subscribed(_bulk_client_id, "symbol-9999"));
+
+    const auto _repeated = _state->subscribe(engine::make_subscriptions(_state->get_id(), _bulk_client_id, _channels));
+    ASSERT_EQ(std::ranges::count(_repeated, true), 0);
+
+    const auto _removed = _state->unsubscribe(engine::make_subscriptions(_state->get_id(), _bulk_client_id, _channels));
+    ASSERT_EQ(std::ranges::count(_removed, true), 10000);
+    ASSERT_EQ(_state->get_subscriptions().size(), 10000);
+    ASSERT_FALSE(_state->is_subscribed(_bulk_client_id, "symbol-0"));
+}
+
+TEST(state_test, keeps_actions_and_channels_apart_when_deduplicating) {
+    const auto _config = std::make_shared<engine::config>();
+    _config->dedup_ttl_ = 5000;
+    const auto _state = std::make_shared<engine::state>(_config);
+
+    const auto _transaction_id = to_string(boost::uuids::random_generator()());
+    const auto _client_id = to_string(boost::uuids::random_generator()());
+    const auto _make = [&](const std::string &action, const std::string &channel) {
+        return boost::json::object{
+            {"action", action},
+            {"transaction_id", _transaction_id},
+            {"params", {{"client_id", _client_id}, {"channel", channel}}},
+        };
+    };
+
+    ASSERT_FALSE(_state->is_duplicate(_make("publish", "general")));
+    ASSERT_TRUE(_state->is_duplicate(_make("publish", "general")));
+
+    // El mismo identificador en otra acción u otro canal es un mensaje distinto.
+    ASSERT_FALSE(_state->is_duplicate(_make("broadcast", "general")));
+    ASSERT_FALSE(_state->is_duplicate(_make("publish", "random")));
+}
+
+TEST(state_test, replay_never_creates_publish_logs) {
+    const auto _config = std::make_shared<engine::config>();
+    _config->history_messages_ = 16;
+    _config->publish_log_path_ = (std::filesystem::temp_directory_path() / "state_test_publish_log").string();
+    std::filesystem::remove_all(_config->publish_log_path_);
+
+    const auto _state = std::make_shared<engine::state>(_config);
+    const auto _client_id = boost::uuids::random_generator()();
+    _state->add_client(std::make_shared<engine::client>(_state->get_id(), _state, _client_id));
+
+    // Suscribirse con una repetición a canales inventados no deja directorios ni historiales.
+    ASSERT_EQ(_state->replay(_client_id, "unknown", 0, std::nullopt), 0);
+    ASSERT_EQ(_state->replay(_client_id, std::string(200, 'x'), 0, std::nullopt), 0);
+    ASSERT_FALSE(std::filesystem::exists(_config->publish_log_path_));
+
+    std::filesystem::remove_all(_config->publish_log_path_);
+}
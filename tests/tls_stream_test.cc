@@ -0,0 +1,119 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <functional>
+
+#include <engine/tls_stream.hpp>
+#include <engine/state.hpp>
+#include <engine/server.hpp>
+
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/program_options/parsers.hpp>
+
+TEST(tls_stream_test, falls_back_to_user_space_without_handshake) {
+    boost::asio::io_context _io_context;
+    const auto _config = std::make_shared<engine::config>();
+    _config->ssl_ktls_enabled_ = true;
+
+    const auto _state = std::make_shared<engine::state>(_config);
+    _state->prepare_ssl_contexts();
+
+    engine::tls_stream _stream{boost::asio::ip::tcp::socket{_io_context}, _state->get_client_listener_ssl_context()};
+
+    ASSERT_FALSE(_stream.get_kernel_tx());
+    ASSERT_FALSE(_stream.enable_kernel_tx(boost::asio::ssl::stream_base::server));
+    ASSERT_FALSE(_stream.get_kernel_tx());
+}
+
+TEST(tls_stream_test, prepares_contexts_when_enabled_from_command_line) {
+    const char *_argv[] = {"server", "--ssl_ktls=true"};
+
+    boost::program_options::variables_map _vm;
+    store(parse_command_line(2, _argv, engine::server::get_options()), _vm);
+
+    const auto _server = std::make_shared<engine::server>();
+    const auto _state = _server->get_state();
+
+    // Con la configuración por defecto el estado se construye sin preparar los contextos.
+    ASSERT_EQ(SSL_CTX_get_keylog_callback(_state->get_client_listener_ssl_context().native_handle()), nullptr);
+
+    _server->configure(_vm);
+
+    ASSERT_TRUE(_server->get_config()->ssl_ktls_enabled_);
+    for (auto *_context: {
+             &_state->get_session_listener_ssl_context(), &_state->get_session_ssl_context(),
+             &_state->get_client_listener_ssl_context(), &_state->get_client_ssl_context()
+         })
+        ASSERT_NE(SSL_CTX_get_keylog_callback(_context->native_handle()), nullptr);
+
+    ASSERT_EQ(SSL_CTX_get_num_tickets(_state->get_session_listener_ssl_context().native_handle()), 0);
+    ASSERT_EQ(SSL_CTX_get_num_tickets(_state->get_client_listener_ssl_context().native_handle()), 0);
+}
+
+TEST(tls_stream_test, closes_on_key_update_request_with_kernel_tx) {
+    boost::asio::io_context _io_context;
+    const auto _config = std::make_shared<engine::config>();
+    _config->ssl_ktls_enabled_ = true;
+
+    const auto _state = std::make_shared<engine::state>(_config);
+    _state->prepare_ssl_contexts();
+
+    boost::asio::ip::tcp::acceptor _acceptor{_io_context, {boost::asio::ip::make_address("127.0.0.1"), 0}};
+    boost::asio::ip::tcp::socket _connected{_io_context};
+    _connected.connect(_acceptor.local_endpoint());
+
+    engine::tls_stream _stream{_acceptor.accept(), _state->get_client_listener_ssl_context()};
+    boost::asio::ssl::stream<boost::asio::ip::tcp::socket> _peer{std::move(_connected), _state->get_client_ssl_context()};
+
+    boost::system::error_code _server_ec, _peer_ec;
+    _stream.async_handshake(boost::asio::ssl::stream_base::server,
+                            [&_server_ec](const boost::system::error_code &ec) { _server_ec = ec; });
+    _peer.async_handshake(boost::asio::ssl::stream_base::client,
+                          [&_peer_ec](const boost::system::error_code &ec) { _peer_ec = ec; });
+    _io_context.run();
+
+    ASSERT_FALSE(_server_ec);
+    ASSERT_FALSE(_peer_ec);
+
+    if (!_stream.enable_kernel_tx(boost::asio::ssl::stream_base::server))
+        GTEST_SKIP() << "kernel TLS is not available";
+
+    // Lo escrito por el kernel debe descifrarse del otro lado con OpenSSL.
+    const std::string _hello = "hello";
+    _io_context.restart();
+    boost::asio::async_write(_stream, boost::asio::buffer(_hello),
+                             [&_server_ec](const boost::system::error_code &ec, std::size_t) { _server_ec = ec; });
+    _io_context.run();
+    ASSERT_FALSE(_server_ec);
+
+    std::string _received(_hello.size(), '\0');
+    boost::asio::read(_peer, boost::asio::buffer(_received));
+    ASSERT_EQ(_received, _hello);
+
+    // El par pide rotar llaves, la respuesta no puede salir cifrada dos veces y la conexión se cierra.
+    ASSERT_EQ(SSL_key_update(_peer.native_handle(), SSL_KEY_UPDATE_REQUESTED), 1);
+    boost::asio::write(_peer, boost::asio::buffer(std::string("ping")));
+
+    std::array<char, 64> _buffer{};
+    _server_ec = {};
+    std::function<void()> _read = [&] {
+        _stream.async_read_some(boost::asio::buffer(_buffer), [&](const boost::system::error_code &ec, std::size_t) {
+            _server_ec = ec;
+            if (!ec)
+                _read();
+        });
+    };
+
+    _io_context.restart();
+    _read();
+    _io_context.run();
+    ASSERT_TRUE(_server_ec);
+
+    boost::asio::read(_peer, boost::asio::buffer(_received), _peer_ec);
+    ASSERT_TRUE(_peer_ec == boost::asio::error::eof || _peer_ec == boost::asio::ssl::error::stream_truncated)
+        << _peer_ec.message();
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/kernel.hpp>
+#include <engine/kernel_context.hpp>
+
+#include <engine/response.hpp>
+#include <engine/state.hpp>
+#include <engine/logger.hpp>
+
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include "../helpers.hpp"
+
+using namespace engine;
+
+TEST(validators_load_validator_test, on_fractional_clients) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "load"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"params", {{"clients", 1.0}, {"rate", 0}, {"queued", 0}}}
+    };
+
+    const auto _response = kernel(_state, _data, on_session, boost::uuids::random_generator()());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "failed", "unprocessable entity", _transaction_id);
+
+    ASSERT_EQ(_response->get_data().at("data").as_object().at("params").as_string(),
+              "params clients attribute must be positive integer");
+}
+
+TEST(validators_load_validator_test, on_negative_queued) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "load"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"params", {{"clients", 1}, {"rate", 0}, {"queued", -1}}}
+    };
+
+    const auto _response = kernel(_state, _data, on_session, boost::uuids::random_generator()());
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(_response->get_failed());
+    ASSERT_EQ(_response->get_data().at("data").as_object().at("params").as_string(),
+              "params queued attribute must be positive integer");
+}
@@ -226,3 +226,39 @@ TEST(validators_register_validator_test, on_wrong_registered_primitive) {
     ASSERT_EQ(_response->get_data().at("data").as_object().at("params").as_string(),
               "params registered attribute must be boolean");
 }
+
+TEST(validators_register_validator_test, on_lane_without_state_id) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "register"},
+        {"transaction_id", to_string(_transaction_id)},
+        {
+            "params", {
+
+                {"registered", true},
+                {"sessions_port", 10000},
+                {"clients_port", 9000},
+                {"lane", 1},
+            }
+        }
+    };
+
+    const auto _response = kernel(_state, _data, on_session, _state->get_id());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "failed", "unprocessable entity", _transaction_id);
+
+    ASSERT_TRUE(_response->get_data().contains("data"));
+    ASSERT_TRUE(_response->get_data().at("data").is_object());
+    ASSERT_TRUE(_response->get_data().at("data").as_object().contains("params"));
+    ASSERT_TRUE(_response->get_data().at("data").as_object().at("params").is_string());
+    ASSERT_EQ(_response->get_data().at("data").as_object().at("params").as_string(),
+              "params state_id attribute must be present");
+}
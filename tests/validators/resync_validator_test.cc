@@ -0,0 +1,43 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/kernel.hpp>
+#include <engine/kernel_context.hpp>
+
+#include <engine/response.hpp>
+#include <engine/state.hpp>
+#include <engine/logger.hpp>
+
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include "../helpers.hpp"
+
+using namespace engine;
+
+TEST(validators_resync_validator_test, on_fractional_bucket) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "resync"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"params", {{"buckets", boost::json::array{3.5}}}}
+    };
+
+    const auto _response = kernel(_state, _data, on_session, boost::uuids::random_generator()());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "failed", "unprocessable entity", _transaction_id);
+
+    ASSERT_EQ(_response->get_data().at("data").as_object().at("params").as_string(),
+              "params buckets attribute must contain bucket numbers");
+}
@@ -90,3 +90,38 @@ TEST(validators_subscriptions_validator_test, can_handle_wrong_params_channel_pr
                   "params channel attribute must be string");
     }
 }
+
+TEST(validators_subscriptions_validator_test, can_handle_wrong_params_channels_element_on_subscriptions) {
+    const auto _state = std::make_shared<engine::state>();
+
+    const auto _local_client = std::make_shared<engine::client>(_state->get_id(), _state);
+
+    for (const auto _action: {"subscribe", "unsubscribe"}) {
+        const auto _transaction_id = boost::uuids::random_generator()();
+        const boost::json::object _data = {
+            {"action", _action},
+            {"transaction_id", to_string(_transaction_id)},
+            {
+                "params", {
+                    {"session_id", to_string(_state->get_id())},
+                    {"client_id", to_string(_local_client->get_id())},
+                    {"channels", boost::json::array{"welcome", 7}},
+                }
+            }
+        };
+
+        const auto _response = kernel(_state, _data, on_session, _state->get_id());
+
+        LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+                 serialize(_response->get_data()));
+
+        ASSERT_TRUE(_response->get_processed());
+        ASSERT_TRUE(_response->get_failed());
+
+        test_response_base_protocol_structure(_response, "failed", "unprocessable entity", _transaction_id);
+
+        ASSERT_TRUE(_response->get_data().at("data").as_object().contains("params"));
+        ASSERT_EQ(_response->get_data().at("data").as_object().at("params").as_string(),
+                  "params channels elements must be string");
+    }
+}
@@ -0,0 +1,48 @@
+// Copyright (c) 2025 — 2026 Ian Torres <iantorres@outlook.com>.
+// All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <engine/worker_pool.hpp>
+
+TEST(worker_pool_test, runs_tasks_and_measures_them) {
+    engine::worker_pool _pool;
+
+    int _runs = 0;
+    ASSERT_TRUE(_pool.submit([&_runs] { ++_runs; }, 4));
+    ASSERT_TRUE(_pool.submit([&_runs] { ++_runs; }, 4));
+    ASSERT_EQ(_pool.get_pending(), 2);
+
+    _pool.get_ioc().run();
+
+    ASSERT_EQ(_runs, 2);
+    ASSERT_EQ(_pool.get_pending(), 0);
+    ASSERT_EQ(_pool.get_queue_time().count_, 2);
+    ASSERT_EQ(_pool.get_run_time().count_, 2);
+}
+
+TEST(worker_pool_test, refuses_tasks_beyond_capacity) {
+    engine::worker_pool _pool;
+
+    ASSERT_TRUE(_pool.submit([] {}, 1));
+    ASSERT_FALSE(_pool.submit([] {}, 1));
+    ASSERT_EQ(_pool.get_rejected(), 1);
+
+    // Al terminar la tarea se libera su lugar.
+    _pool.get_ioc().run();
+    _pool.get_ioc().restart();
+
+    ASSERT_TRUE(_pool.submit([] {}, 1));
+    ASSERT_EQ(_pool.get_pending(), 1);
+}
+
+TEST(worker_pool_test, releases_the_slot_when_a_task_throws) {
+    engine::worker_pool _pool;
+
+    ASSERT_TRUE(_pool.submit([] { throw 42; }, 1));
+    ASSERT_THROW(_pool.get_ioc().run(), int);
+    ASSERT_EQ(_pool.get_pending(), 0);
+
+    _pool.get_ioc().restart();
+    ASSERT_TRUE(_pool.submit([] {}, 1));
+}